@@ -0,0 +1,127 @@
+/**
+ * @file CcTalk.cpp
+ * @author Thomas Schöpf / Hanimat
+ * @brief ccTalk Protokollschicht für Münzprüfer und Banknotenprüfer (CC BY-NC-SA 4.0, siehe main.cpp).
+ */
+#include "CcTalk.h"
+
+#include <string.h>
+
+uint8_t ccTalkChecksum(const uint8_t* bytes, size_t length) {
+  uint8_t sum = 0;
+  for (size_t i = 0; i < length; i++) sum += bytes[i];
+  return (uint8_t)(0 - sum);
+}
+
+int ccTalkNewEvents(uint8_t last, uint8_t counter) {
+  int events = (int)counter - (int)last;
+  return events < 0 ? events + 255 : events;
+}
+
+bool ccTalkDecodeEvents(uint8_t lastCounter, const uint8_t* reply, int length, CcTalkEvents& events) {
+  memset(&events, 0, sizeof(events));
+  if (length < 1 + 2 * CCTALK_EVENT_SLOTS) return false;
+  events.counter = reply[0];
+  if (events.counter == 0 && lastCounter != 0) {
+    events.reset = true; // Type table and inhibits are back to defaults, buffered events are gone
+    return true;
+  }
+  int count = ccTalkNewEvents(lastCounter, events.counter);
+  if (count > CCTALK_EVENT_SLOTS) {
+    events.lost = count - CCTALK_EVENT_SLOTS;
+    count = CCTALK_EVENT_SLOTS;
+  }
+  for (int i = 0; i < count; i++) { // Result 1 is the newest
+    int slot = count - 1 - i;
+    events.type[i] = reply[1 + 2 * slot];
+    events.code[i] = reply[2 + 2 * slot];
+  }
+  events.count = count;
+  return true;
+}
+
+/**
+ * @brief Reads exactly length bytes. Returns false if deadlineMs passes first.
+ */
+bool CcTalkBus::readBytes(uint8_t* out, size_t length, unsigned long deadlineMs) {
+  size_t received = 0;
+  while (received < length) {
+    int c = port.read();
+    if (c >= 0) {
+      out[received++] = (uint8_t)c;
+    } else if ((long)(clock() - deadlineMs) >= 0) {
+      return false;
+    } else if (idle != nullptr) {
+      idle();
+    }
+  }
+  return true;
+}
+
+int CcTalkBus::transact(uint8_t address, uint8_t header, const uint8_t* data, uint8_t length,
+                        uint8_t* reply, uint8_t replyMax) {
+  uint8_t frame[CCTALK_MAX_DATA + 5];
+  if (length > CCTALK_MAX_DATA) return CCTALK_ERR_FRAME;
+  frame[0] = address;
+  frame[1] = length;
+  frame[2] = CCTALK_HOST_ADDRESS;
+  frame[3] = header;
+  if (length > 0) memcpy(frame + 4, data, length);
+  frame[4 + length] = ccTalkChecksum(frame, 4 + length);
+  size_t frameLength = 5 + length;
+
+  while (port.read() >= 0) {} // Drop leftovers of an earlier, timed-out reply
+  port.write(frame, frameLength);
+  port.flush();
+  unsigned long deadline = clock() + CCTALK_REPLY_TIMEOUT_MS;
+
+  uint8_t in[CCTALK_MAX_DATA + 5];
+  if (localEcho) {
+    if (!readBytes(in, frameLength, deadline)) return CCTALK_ERR_TIMEOUT; // Bus fault
+    if (memcmp(in, frame, frameLength) != 0) return CCTALK_ERR_FRAME;     // Collision
+  }
+  if (!readBytes(in, 4, deadline)) return CCTALK_ERR_TIMEOUT;
+  uint8_t replyLength = in[1];
+  if (in[0] != CCTALK_HOST_ADDRESS || in[2] != address || replyLength > CCTALK_MAX_DATA) return CCTALK_ERR_FRAME;
+  if (!readBytes(in + 4, replyLength + 1, deadline)) return CCTALK_ERR_TIMEOUT;
+  if (ccTalkChecksum(in, 5 + replyLength) != 0) return CCTALK_ERR_FRAME;
+  if (in[3] != CCTALK_HDR_ACK) return CCTALK_ERR_NAK;
+
+  uint8_t copied = replyLength < replyMax ? replyLength : replyMax;
+  if (copied > 0) memcpy(reply, in + 4, copied);
+  return copied;
+}
+
+int CcTalkBus::setInhibits(uint8_t address, uint16_t enableMask) {
+  uint8_t data[2] = { (uint8_t)(enableMask & 0xFF), (uint8_t)(enableMask >> 8) };
+  return transact(address, CCTALK_HDR_MODIFY_INHIBITS, data, 2, nullptr, 0);
+}
+
+int CcTalkBus::setMasterEnable(uint8_t address, bool enabled) {
+  uint8_t data = enabled ? 1 : 0;
+  return transact(address, CCTALK_HDR_MODIFY_MASTER_INHIBIT, &data, 1, nullptr, 0);
+}
+
+int CcTalkBus::readEvents(uint8_t address, bool bill, uint8_t lastCounter, CcTalkEvents& events) {
+  uint8_t reply[CCTALK_MAX_DATA];
+  int length = transact(address, bill ? CCTALK_HDR_READ_BILL_EVENTS : CCTALK_HDR_READ_COIN_EVENTS,
+                        nullptr, 0, reply, sizeof(reply));
+  if (length < 0) return length;
+  return ccTalkDecodeEvents(lastCounter, reply, length, events) ? length : CCTALK_ERR_FRAME;
+}
+
+uint16_t CcTalkBus::typeValue(uint8_t address, bool bill, const uint8_t* id, int length) {
+  int digits = bill ? 4 : 3;
+  if (length < 2 + digits) return 0;
+  uint32_t value = 0;
+  for (int i = 2; i < 2 + digits; i++) {
+    if (id[i] < '0' || id[i] > '9') return 0;
+    value = value * 10 + (id[i] - '0');
+  }
+  uint8_t scaling[3];
+  if (bill && value > 0 && transact(address, CCTALK_HDR_REQUEST_SCALING, id, 2, scaling, sizeof(scaling)) == 3) {
+    value *= scaling[0] | (scaling[1] << 8);
+    for (int i = 0; i < scaling[2]; i++) value /= 10;
+  }
+  return (uint16_t)(value < 65535 ? value : 65535);
+}
@@ -0,0 +1,114 @@
+/**
+ * @file CcTalk.h
+ * @author Thomas Schöpf / Hanimat
+ * @brief ccTalk Protokollschicht für Münzprüfer und Banknotenprüfer (CC BY-NC-SA 4.0, siehe main.cpp).
+ *
+ * Framing, checksum, transactions and event buffer decoding. Depends only on a Stream and a
+ * millisecond clock, so the firmware drives it over a UART and the native tests
+ * (test/test_cctalk) drive it against a simulated device.
+ */
+#pragma once
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#define CCTALK_HOST_ADDRESS 1
+#define CCTALK_MAX_DATA 32                // Longest data block we send or accept
+#define CCTALK_REPLY_TIMEOUT_MS 100       // Incl. echo; replies to our headers are < 20 bytes (~20 ms)
+#define CCTALK_TYPES 16                   // Coin / bill types per device (1-16)
+#define CCTALK_EVENT_SLOTS 5              // Events kept in a device's buffer
+
+// ccTalk headers used by the driver
+#define CCTALK_HDR_ACK 0
+#define CCTALK_HDR_NAK 5
+#define CCTALK_HDR_BUSY 6
+#define CCTALK_HDR_SIMPLE_POLL 254
+#define CCTALK_HDR_READ_COIN_EVENTS 229
+#define CCTALK_HDR_MODIFY_INHIBITS 231
+#define CCTALK_HDR_MODIFY_MASTER_INHIBIT 228
+#define CCTALK_HDR_REQUEST_COIN_ID 184
+#define CCTALK_HDR_READ_BILL_EVENTS 159
+#define CCTALK_HDR_REQUEST_BILL_ID 157
+#define CCTALK_HDR_REQUEST_SCALING 156
+#define CCTALK_HDR_ROUTE_BILL 154
+#define CCTALK_BILL_STACKED 0             // Bill event code: validated and stacked
+#define CCTALK_BILL_ESCROW 1              // Bill event code: held in escrow, host must route it
+#define CCTALK_ROUTE_RETURN 0
+#define CCTALK_ROUTE_STACK 1
+
+// Negative results of CcTalkBus::transact()
+#define CCTALK_ERR_TIMEOUT -1             // Echo or reply incomplete when the deadline passed
+#define CCTALK_ERR_FRAME -2               // Echo garbled (collision), wrong address, length or checksum
+#define CCTALK_ERR_NAK -3                 // Device answered NAK, BUSY or anything but ACK
+
+/**
+ * @brief New events of one read of a device's event buffer, oldest first.
+ */
+struct CcTalkEvents {
+  uint8_t counter;                        // Event counter of this read
+  int count;                              // Entries in type/code
+  int lost;                               // Events overwritten in the device before this read
+  bool reset;                             // Counter back to 0: the device was power cycled
+  uint8_t type[CCTALK_EVENT_SLOTS];       // Result A: coin/bill type, 0 = status event
+  uint8_t code[CCTALK_EVENT_SLOTS];       // Result B: sorter path / bill event / status code
+};
+
+/**
+ * @brief ccTalk simple checksum: makes all bytes of a frame sum to 0 (mod 256).
+ */
+uint8_t ccTalkChecksum(const uint8_t* bytes, size_t length);
+
+/**
+ * @brief Events between two event counter readings. The counter runs 1..255 and skips 0, which
+ *        it only holds after a device reset.
+ */
+int ccTalkNewEvents(uint8_t last, uint8_t counter);
+
+/**
+ * @brief Decodes a read coin/bill events reply (counter + CCTALK_EVENT_SLOTS result pairs,
+ *        newest first) against the counter of the previous read. Returns false if the reply
+ *        is too short.
+ */
+bool ccTalkDecodeEvents(uint8_t lastCounter, const uint8_t* reply, int length, CcTalkEvents& events);
+
+/**
+ * @brief One ccTalk bus as seen from the host. Not thread-safe: one task owns the bus.
+ */
+class CcTalkBus {
+public:
+  typedef unsigned long (*Clock)();       // Milliseconds, wraps like millis()
+  typedef void (*Idle)();                 // Called while waiting for bytes, may be null
+
+  CcTalkBus(Stream& port, Clock clock, Idle idle = nullptr, bool localEcho = true)
+      : port(port), clock(clock), idle(idle), localEcho(localEcho) {}
+
+  /**
+   * @brief Sends one command and waits for the ACK reply. Returns the number of reply data bytes
+   *        copied to reply, or CCTALK_ERR_TIMEOUT / CCTALK_ERR_FRAME / CCTALK_ERR_NAK.
+   */
+  int transact(uint8_t address, uint8_t header, const uint8_t* data, uint8_t length, uint8_t* reply, uint8_t replyMax);
+
+  /** @brief Sends the per-type enable mask (ccTalk inhibit bits: 1 = accepted). */
+  int setInhibits(uint8_t address, uint16_t enableMask);
+
+  /** @brief Enables or disables acceptance as a whole (master inhibit). */
+  int setMasterEnable(uint8_t address, bool enabled);
+
+  /** @brief Reads and decodes the event buffer. Returns a transact() error or the reply length. */
+  int readEvents(uint8_t address, bool bill, uint8_t lastCounter, CcTalkEvents& events);
+
+  /**
+   * @brief Value of a coin/bill type from its ID string ("EU200A" = 200 cents, "EU0005A" = 5 EUR
+   *        times the country scaling factor read from the device). Returns 0 for unused types.
+   */
+  uint16_t typeValue(uint8_t address, bool bill, const uint8_t* id, int length);
+
+private:
+  Stream& port;
+  Clock clock;
+  Idle idle;
+  bool localEcho;                         // Single-wire bus: the own frame is received before the reply
+
+  bool readBytes(uint8_t* out, size_t length, unsigned long deadlineMs);
+};
@@ -48,11 +48,23 @@
 #include <Update.h>
 #include <UniversalTelegramBot.h> // Telegram Bot Library
 #include <ArduinoJson.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <atomic>
+#include <esp_partition.h>
+#include <driver/pcnt.h>
+#include "esp32/rom/crc.h"
+#include <CcTalk.h> // lib/CcTalk: ccTalk protocol layer
+#include <time.h>
 
 // --- Custom Fonts ---
 #include "fonts/Poppins_Black_14.h"
 #include "fonts/Poppins_Regular_10.h"
 #include "fonts/Poppins_Regular_7.h"
+#include "web/admin_app.h" // Generated by tools/embed_web.py
 
 
 // =================================================================
@@ -66,11 +78,10 @@ const String FIRMWARE_VERSION = "V1.2.5-noec";
 
 // --- Vending Machine Configuration ---
 const int DEFAULT_MAX_SLOTS = 16;
-const int MAX_SLOTS = 16;
+const int MAX_SLOTS = 128;  // RELAY_MAX_EXPANDERS * RELAYS_PER_EXPANDER; the fitted expanders set the usable part
 
 // --- Timing and Timeout Values (in milliseconds) ---
 unsigned long COIN_PROCESSING_DELAY = 150;
-unsigned long BILL_ISR_DEBOUNCE_MS = 75;
 unsigned long BILL_GROUP_PROCESSING_TIMEOUT_MS = 1500;
 unsigned long DISPENSE_RELAY_ON_TIME = 5000;
 unsigned long KEYPAD_INPUT_TIMEOUT = 3000;
@@ -78,6 +89,7 @@ unsigned long WEB_TIMEOUT = 600000;
 unsigned long SLOT_SELECTION_TIMEOUT = 10000;
 unsigned long DISPLAY_TIMEOUT = 20000;
 const unsigned long STARTUP_IGNORE_BILL_TIME = 5000; // Ignore bill pulses briefly on startup
+const unsigned long ERROR_DISPLAY_TIME = 3000;       // How long displayErrorMessage() stays up
 const long TELEGRAM_CHECK_INTERVAL = 5000; // Not currently used, but can be for polling
 
 // --- Hardware Pin Definitions ---
@@ -97,11 +109,15 @@ const long TELEGRAM_CHECK_INTERVAL = 5000; // Not currently used, but can be for
 #define OFFLINE_MODE_PIN 27
 
 // --- Payment Mapping ---
-// Maps the number of pulses to a cent value for coins. Index is the pulse count.
-const int pulseValues[] = {0, 0, 10, 20, 50, 100, 200}; // 0, 1, 2, 3, 4, 5, 6 pulses
-
-// Maps the number of pulses to a Euro value for bills. Index is the pulse count.
-const int billValues[]  = {
+// Maps the number of pulses to a value, index is the pulse count, 0 = not accepted.
+// These are the defaults; the tables are stored in NVS (see PulseTableBlob) and can be
+// edited or learned from the web UI.
+#define PULSE_TABLE_SIZE 48
+// Coins, in cents
+uint16_t pulseValues[PULSE_TABLE_SIZE] = {0, 0, 10, 20, 50, 100, 200}; // 0, 1, 2, 3, 4, 5, 6 pulses
+
+// Bills, in euros
+uint16_t billValues[PULSE_TABLE_SIZE]  = {
 //Pulses: 0, 1, 2, 3, 4, 5, 6, 7, 8,  9, 10, 11, 12, 13, 14, 15, 16
           0, 0, 0, 0, 5, 0, 0, 0, 10, 0, 0,  0,  0,  0,  0,  0,  20
 };
@@ -125,17 +141,213 @@ CurrentSystemState currentSystemState = CurrentSystemState::IDLE;
 // --- Timing & State Tracking ---
 unsigned long slotSelectedTime = 0;
 unsigned long bootTime = 0;
-unsigned long lastRelayChangeTime = 0;
 unsigned long lastUserInteractionTime = 0;
+unsigned long errorDisplayUntil = 0;       // End of the error message while in ERROR_DISPLAY
 
 // --- Web Server & Storage ---
 WebServer server(80);
-Preferences preferences;
+Preferences preferences;    // Used by the vending task only
+Preferences webPreferences; // Used by the web handlers (network task) only
+#define RESPONSE_CHUNK_SIZE 512 // Send buffer of ChunkedResponseWriter (network task stack)
+
+// --- Settings Cache (write-behind) ---
+// Credit and slot state live in RAM; changes are marked dirty and committed to NVS
+// in one session after a quiet period or on a state transition.
+#define SETTINGS_COMMIT_QUIET_MS 2000
+struct SettingsCacheState {
+  bool creditDirty;
+  bool slotTableDirty;        // Prices, availability, locks or active slot count
+  unsigned long lastChangeTime;
+};
+SettingsCacheState settingsCache = { false, false, 0 };
+
+// --- Slot Table Blob ---
+// All slot data is stored as one CRC-checked struct under a single NVS key. The layout depends
+// on the slot count, so tables written by firmware with fewer slots are read with their own size.
+#define SLOT_TABLE_KEY "slotTable"
+#define SLOT_TABLE_VERSION 1
+#define SLOT_TABLE_LEGACY_SLOTS 16   // Slot count of firmware up to V1.2.5
+template <int SLOTS>
+struct SlotTableLayout {
+  uint16_t version;
+  uint16_t slotCount;          // SLOTS
+  int32_t activeSlots;
+  float prices[SLOTS];
+  uint8_t available[SLOTS];
+  uint8_t locked[SLOTS];
+  uint32_t crc;                // CRC32 over all fields above
+};
+typedef SlotTableLayout<MAX_SLOTS> SlotTableBlob;
+
+// --- Pulse Table Blob ---
+// Both pulse-to-value tables, stored as one CRC-checked struct under a single NVS key.
+#define PULSE_TABLE_KEY "pulseTable"
+#define PULSE_TABLE_VERSION 1
+struct PulseTableBlob {
+  uint16_t version;
+  uint16_t tableSize;          // PULSE_TABLE_SIZE at the time of writing
+  uint16_t coinCents[PULSE_TABLE_SIZE];
+  uint16_t billEuros[PULSE_TABLE_SIZE];
+  uint32_t crc;                // CRC32 over all fields above
+};
+
+// --- Door Sensor Blob ---
+// Sensor assignment of every slot plus the level that means "door open", one CRC-checked struct.
+#define DOOR_SENSOR_KEY "doorSensors"
+#define DOOR_SENSOR_VERSION 1
+struct DoorSensorBlob {
+  uint16_t version;
+  uint8_t openHigh;            // 1 = input HIGH means open
+  uint8_t reserved;
+  uint8_t sensors[MAX_SLOTS];  // See DOOR_SENSOR_NONE / DOOR_SENSOR_GPIO
+  uint32_t crc;                // CRC32 over all fields above
+};
+
+// --- Money Journal ---
+// Append-only records in the "journal" flash partition keep credit changes safe
+// until the next NVS commit. Writing to erased flash needs no erase cycle; the next
+// sector is erased ahead by journalEraseTask(), so appends on the credit path only write.
+// The erase ahead is queued only once the first record of the current sector is verified,
+// so the records of the previous sector survive until a newer one is safely on flash.
+#define JOURNAL_PARTITION_LABEL "journal"
+#define JOURNAL_RECORD_MAGIC 0xC0DE
+struct JournalRecord {
+  uint16_t magic;
+  uint16_t reserved;
+  uint32_t sequence;
+  int32_t creditCents;   // Credit after the event
+  uint32_t crc;          // CRC32 over the fields above
+};
+const esp_partition_t* journalPartition = nullptr;
+uint32_t journalWriteOffset = 0;
+uint32_t journalSequence = 0;        // Sequence of the last appended record
+uint32_t committedJournalSequence = 0; // Sequence covered by the last NVS commit
+#define JOURNAL_SECTOR_NONE 0xFFFFFFFFUL
+SemaphoreHandle_t journalEraseMutex = nullptr;       // Guards the two sector offsets below
+uint32_t journalEraseTarget = JOURNAL_SECTOR_NONE;   // Sector journalEraseTask() should erase next
+uint32_t journalErasedSector = JOURNAL_SECTOR_NONE;  // Sector erased ahead and not yet entered
+TaskHandle_t journalEraseTaskHandle = nullptr;
+
+// --- Sales Ledger ---
+// Fixed-size records in the "ledger" partition, written as a ring over all sectors
+// (even wear). Record n lives at slot (n - 1) % capacity, so any record is one read away.
+#define LEDGER_PARTITION_LABEL "ledger"
+#define LEDGER_RECORD_MAGIC 0x5A1E
+#define LEDGER_FLAG_TIME_VALID 0x01   // timestamp is Unix time (NTP), otherwise uptime seconds
+#define LEDGER_FLAG_CASHLESS 0x02     // Partly paid by card: the part not taken from credit
+#define LEDGER_FLAG_DOOR_UNCONFIRMED 0x04 // The slot has a door sensor and it never reported the door open
+#define LEDGER_QUEUE_LENGTH 16
+#define LEDGER_PAGE_MAX 50
+struct LedgerRecord {
+  uint16_t magic;
+  uint8_t slot;                // Slot index (0-based)
+  uint8_t flags;
+  uint32_t sequence;           // 1-based, strictly increasing
+  uint32_t timestamp;
+  uint16_t priceCents;
+  uint16_t coinCents;          // Coins inserted since the previous sale
+  int32_t creditBeforeCents;
+  int32_t creditAfterCents;
+  uint16_t billEuros;          // Bills inserted since the previous sale
+  int16_t manualCents;         // Web credit adjustments since the previous sale
+  uint32_t crc;                // CRC32 over all fields above
+};
+static_assert(sizeof(LedgerRecord) == 32, "LedgerRecord must divide the flash sector size");
+const esp_partition_t* ledgerPartition = nullptr;
+uint32_t ledgerCapacity = 0;                 // Records in the partition
+volatile uint32_t ledgerNewestSequence = 0;  // 0 = empty
+volatile uint32_t ledgerDropped = 0;
+QueueHandle_t ledgerQueue = nullptr;
+TaskHandle_t ledgerTaskHandle = nullptr;
+
+// Payment mix of the current customer session (reset after each sale)
+int32_t sessionCoinCents = 0;
+int32_t sessionBillEuros = 0;
+int32_t sessionManualCents = 0;
 
 // --- Relay Control ---
+// PCA9555-type 16-bit expanders at consecutive addresses from RELAY_I2C_ADDRESS, found by the probe.
+// Slot n is bit n % 16 of expander n / 16 (port 0 = bits 0-7, port 1 = bits 8-15). setSlotRelay()
+// only changes the shadow register; commitRelayOutputs() writes each changed expander with one
+// transaction (both ports through register auto-increment).
 #define RELAYS_PER_EXPANDER 16
-#define NUM_EXPANDERS 1
-static uint16_t expanderOutputStates[NUM_EXPANDERS]; // Bitmask for relay states
+#define RELAY_MAX_EXPANDERS 8        // Address pins A0-A2: RELAY_I2C_ADDRESS + 0..7
+#define RELAY_REG_INPUT 0x00         // Input port 0 (pin levels, also of outputs), port 1 follows
+#define RELAY_REG_OUTPUT 0x02        // Output port 0, port 1 follows
+#define RELAY_REG_CONFIG 0x06        // Configuration port 0 (0 = output), port 1 follows
+static_assert(MAX_SLOTS == RELAY_MAX_EXPANDERS * RELAYS_PER_EXPANDER, "MAX_SLOTS must match the relay address space");
+static uint16_t expanderOutputStates[RELAY_MAX_EXPANDERS]; // Shadow of the output registers
+uint8_t expanderDirtyMask = 0;       // Bit n: shadow of expander n not yet written
+std::atomic<int> relayExpanderCount(0); // Expanders found so far, only grows (set by i2cTask())
+int doorSensorExpanders = 0;         // relayExpanderCount that applyDoorSensors() last configured
+
+// --- I2C Bus Task ---
+// i2cTask() owns Wire. Relay writes are queued as I2cRequests and answered with I2cResults, so a
+// stuck bus never stalls the vending task. A failed transaction is retried with growing pauses;
+// from the I2C_RECOVERY_AFTER-th failure on, the bus is recovered first (SCL clocking, STOP) and
+// every expander gets its configuration and last requested outputs again.
+// Whenever the queue has been idle for RELAY_HEALTH_INTERVAL_MS the task reads back the output
+// and configuration registers of all expanders; an expander that lost them (brown-out reset to
+// inputs) is configured again. Before that it probes the address after the last expander found,
+// so a board that missed the boot probe (or was plugged in later) is taken into use without a
+// reboot. The outcome of every transaction updates the cached board state
+// that checkRelayBoardOnline() returns without touching the bus.
+#define I2C_SDA_PIN 21               // Wire defaults of the ESP32, used since the first relay board
+#define I2C_SCL_PIN 22
+#define I2C_CLOCK_HZ 50000           // Slow clock for stability on the relay board cable
+#define I2C_TIMEOUT_MS 20            // Wire timeout of one transaction
+#define I2C_TASK_CORE 0
+#define I2C_TASK_PRIORITY 2
+#define I2C_TASK_STACK_SIZE 4096
+#define I2C_QUEUE_LENGTH 16
+#define I2C_MAX_ATTEMPTS 4
+#define I2C_RETRY_BASE_MS 5          // Pause after attempt n: I2C_RETRY_BASE_MS << (n - 1)
+#define I2C_RECOVERY_AFTER 2
+#define I2C_READY_TIMEOUT_MS 2000    // setup() waits this long for the expander initialization
+#define RELAY_HEALTH_INTERVAL_MS 2000
+#define RELAY_PROBE_ATTEMPTS 3       // Boot probes per address, a slow board may miss the first
+#define RELAY_PROBE_RETRY_MS 20
+#define RELAY_HEALTH_STALE_MS 10000  // Board state older than this counts as offline (I2C task hung)
+#define RELAY_RESULT_TIMEOUT_MS 2000 // A dispense gives up if its relay write is not answered
+#define I2C_ERROR_READBACK 0x10      // Not a Wire code: the pins did not take the written outputs
+enum class I2cOp : uint8_t {
+  WRITE_OUTPUTS,   // Output registers of one expander
+  HEALTH_CHECK,    // Read back every expander found so far, re-apply lost configuration
+  READ_INPUTS,     // Input registers of one expander (door sensors)
+  SET_INPUTS       // Pins of one expander used as inputs (value = mask)
+};
+struct I2cRequest {
+  I2cOp op;
+  uint8_t expander;
+  uint16_t value;
+  uint32_t tag;              // Returned unchanged in the result
+  QueueHandle_t replyQueue;  // Receives the I2cResult, nullptr = none
+};
+struct I2cResult {
+  uint32_t tag;
+  I2cOp op;
+  uint8_t expander;          // Expander of the request, for HEALTH_CHECK the first one that failed
+  uint8_t error;             // Wire error code of the last attempt (or I2C_ERROR_READBACK), 0 = success
+  uint16_t mismatch;         // WRITE_OUTPUTS: pins that differ from the written value
+  uint16_t pins;             // READ_INPUTS: pin levels
+  uint8_t attempts;
+  uint32_t doneAt;           // millis() after the last attempt, i.e. when READ_INPUTS sampled the pins
+};
+QueueHandle_t i2cRequestQueue = nullptr;
+QueueHandle_t relayResultQueue = nullptr;  // i2cTask() -> vending task (VENDING_EVENT_RELAY)
+SemaphoreHandle_t i2cReady = nullptr;      // Given once the expanders are initialized
+TaskHandle_t i2cTaskHandle = nullptr;
+static uint16_t i2cExpanderOutputs[RELAY_MAX_EXPANDERS]; // Last confirmed outputs, owned by i2cTask()
+static uint16_t i2cExpanderInputs[RELAY_MAX_EXPANDERS];  // Pins configured as inputs, owned by i2cTask()
+uint32_t relayRequestCounter = 0;          // Tags of relay writes the vending task waits for
+std::atomic<uint32_t> i2cRetries(0);
+std::atomic<uint32_t> i2cRecoveries(0);
+std::atomic<uint32_t> i2cFailures(0);      // Requests that failed in every attempt
+std::atomic<bool> relayBoardOnline(false);
+std::atomic<uint32_t> relayBoardOnlineSince(0); // millis() of the last offline -> online change
+std::atomic<uint32_t> relayBoardLastSeen(0);    // millis() of the last successful transaction
+std::atomic<uint32_t> relayBrownouts(0);        // Expanders found with lost configuration
+std::atomic<uint32_t> relayReadbackErrors(0);   // Writes whose pins read back differently
 
 // --- Keypad Configuration ---
 const byte KEYPAD_ROWS = 4;
@@ -176,13 +388,246 @@ bool telegramNotifyEmpty = true;
 
 // --- Payment & Credit ---
 float credit = 0.0;
-volatile int coinPulseCount = 0;
-volatile unsigned long lastCoinPulseTime = 0;
 
-volatile unsigned long billAcceptorPulseCount = 0;
-volatile unsigned long lastBillPulseEdgeTime = 0;
-volatile unsigned long lastBillDebounceEdgeTime = 0;
+// --- Pulse Counting (PCNT) ---
+// Coin and bill pulses are counted in hardware, behind the PCNT glitch filter, so the count is
+// right even while flash writes have interrupts disabled. The edge ISRs only push an
+// esp_timer_get_time() stamp into a lock-free SPSC ring; a periodic esp_timer drains the rings,
+// measures the inter-pulse interval and closes a group once the line has been quiet for
+// PULSE_GAP_INTERVALS intervals (the configured timeouts are only the upper bound).
+// Counters free-run, so no pulse is lost to a read/clear race.
+//
+// Bill edges are stamped on both flanks together with the line level and every pulse is
+// validated by width and period, so relay spikes are rejected by shape. For bills the count
+// of valid pulses is used. A bill group whose ring lost stamps is not credited: the PCNT count
+// would include the spikes the validation exists to reject, and overflows come with noise bursts.
+#define COIN_PCNT_UNIT PCNT_UNIT_0
+#define BILL_PCNT_UNIT PCNT_UNIT_1
+#define PCNT_COUNTER_LIMIT 32767     // The counter wraps to 0 when it reaches this value
+#define PCNT_GLITCH_FILTER_TICKS 1023 // APB cycles (80 MHz): pulses shorter than ~12.8 us are ignored
+#define PULSE_POLL_INTERVAL_MS 10
+#define PULSE_RING_SIZE 64           // Power of two
+#define PULSE_GAP_INTERVALS 2        // Quiet time, in inter-pulse intervals, that closes a group
+#define PULSE_GAP_MIN_MS 30
+#define BILL_PULSE_MIN_WIDTH_US 20000UL  // The acceptor pulls the line LOW for 50-100 ms per pulse
+#define BILL_PULSE_MAX_WIDTH_US 250000UL
+#define BILL_PULSE_MIN_PERIOD_US 40000UL // Start to start
+#define BILL_EDGE_GLITCH_US 2000UL   // A HIGH gap this short inside a pulse is a spike, not two pulses
+#define PULSE_GROUP_QUEUE_LENGTH 4
+struct PulseRing {
+  uint32_t stamps[PULSE_RING_SIZE];  // esp_timer_get_time() in us (low 32 bits, differences only);
+                                     // bit 0 holds the line level for edge-validated inputs
+  std::atomic<uint32_t> head;        // Written by the ISR only
+  std::atomic<uint32_t> tail;        // Written by the poll timer only
+  std::atomic<uint32_t> dropped;     // Stamps lost because the ring was full
+};
+struct PulseGroupCounter {
+  pcnt_unit_t unit;
+  PulseRing* ring;
+  bool validateEdges;                // Both flanks stamped, pulses checked by width and period
+  int16_t lastCount;                 // Counter value at the previous poll
+  uint32_t lastDropped;              // ring->dropped at the previous poll
+  int counted;                       // PCNT pulses of the group that is still open
+  int stamped;                       // Time-stamped (for bills: validated) pulses of the open group
+  bool stampsLost;                   // The open group lost stamps (edge-validated: group is dropped)
+  uint32_t lastEdgeUs;               // Newest edge (valid or not) of the open group
+  uint32_t lastStartUs;              // Start of the newest pulse (edge-validated inputs)
+  uint32_t maxIntervalUs;            // Longest inter-pulse interval of the open group
+  uint32_t learnedIntervalUs;        // Running average over closed groups, 0 = not learned yet
+  // Edge decoder state (edge-validated inputs)
+  bool lineLow;
+  uint32_t fallUs;
+  bool riseTentative;                // Rising edge seen, not yet confirmed against a spike
+  uint32_t riseUs;
+  uint32_t rejected;                 // Pulses rejected by shape, handed to the vending task
+  uint32_t lostGroups;               // Edge-validated groups dropped for lost stamps, ditto
+};
+PulseRing coinPulseRing;
+PulseRing billPulseRing;
+PulseGroupCounter coinPulseCounter = { COIN_PCNT_UNIT, &coinPulseRing, false };
+PulseGroupCounter billPulseCounter = { BILL_PCNT_UNIT, &billPulseRing, true };
+struct PulseGroupEvent {
+  int pulses;
+  uint32_t maxIntervalUs;            // Longest inter-pulse interval, 0 for single-pulse groups
+};
+esp_timer_handle_t pulsePollTimer = nullptr;
+std::atomic<bool> pulsePollActive(false); // Poll timer runs only while a pulse group is open
+QueueHandle_t coinGroupQueue = nullptr;  // Every closed coin group (PulseGroupEvent)
+QueueHandle_t billGroupQueue = nullptr;  // Every closed bill group (PulseGroupEvent)
+
+// --- Pulse Learn Mode ---
+// While active, closed groups of one acceptor are not credited but stored in its pulse table
+// under learnValue. The longest inter-pulse interval seen per acceptor gives the tightest safe
+// grouping timeout (LEARN_TIMEOUT_MARGIN_PERCENT of it), which can then be applied once enough
+// multi-pulse groups were measured. The TFT shows the mode and sales are blocked while it runs;
+// it ends by itself after LEARN_MODE_TIMEOUT_MS without an insert. A group whose pulse count
+// already maps to another value is held back until the operator confirms the overwrite.
+#define LEARN_TIMEOUT_MARGIN_PERCENT 150
+#define LEARN_MODE_TIMEOUT_MS 300000UL   // 5 min
+#define LEARN_MIN_INTERVAL_SAMPLES 5     // Multi-pulse groups needed before a timeout is suggested
+enum PulseAcceptor : uint8_t { PULSE_ACCEPTOR_COIN, PULSE_ACCEPTOR_BILL, PULSE_ACCEPTOR_COUNT };
+struct PulseLearnState {
+  bool active;
+  uint8_t acceptor;            // PulseAcceptor
+  uint16_t value;              // Table unit: cents for coins, euros for bills
+  int lastPulses;              // Pulse count of the newest learned group, 0 = none yet
+  unsigned long lastActivity;  // Start or newest group, for LEARN_MODE_TIMEOUT_MS
+  int conflictPulses;          // Group held back for confirmation, 0 = none
+  uint32_t conflictIntervalUs;
+  uint16_t samples[PULSE_ACCEPTOR_COUNT];
+  uint16_t intervalSamples[PULSE_ACCEPTOR_COUNT]; // Multi-pulse groups behind maxIntervalUs
+  uint32_t maxIntervalUs[PULSE_ACCEPTOR_COUNT];
+};
+PulseLearnState pulseLearn = {};
+
+// --- ccTalk Payment Interface ---
+// Alternative to pulse counting: coin acceptor and bill validator on a ccTalk bus (single wire,
+// 9600 8N1, every byte sent is echoed back). ccTalkTask() polls the event buffers of both devices,
+// routes bills held in escrow and keeps the per-denomination inhibit masks applied; accepted
+// coins and bills go through creditEventQueue to the vending task. Framing, transactions and
+// event decoding live in lib/CcTalk (host-tested in test/test_cctalk); this file keeps the
+// device policy: setup, crediting and escrow routing.
+#ifndef PAYMENT_CCTALK
+#define PAYMENT_CCTALK 0                  // Build with -DPAYMENT_CCTALK=1 to use ccTalk instead of pulses
+#endif
+#define CCTALK_UART 2
+#define CCTALK_RX_PIN COIN_ACCEPTOR_PIN   // ccTalk builds wire the bus interface to the pulse inputs
+#define CCTALK_TX_PIN BILL_ACCEPTOR_PIN
+#define CCTALK_BAUD 9600
+#define CCTALK_LOCAL_ECHO 1               // Single-wire bus: the own frame is received before the reply
+#define CCTALK_COIN_ADDRESS 2
+#define CCTALK_BILL_ADDRESS 40
+#define CCTALK_POLL_INTERVAL_MS 100
+#define CCTALK_RETRY_INTERVAL_MS 2000     // Setup retry for a device that is offline
+#define CCTALK_MAX_FAILURES 3             // Consecutive failed polls before a device counts as offline
+#define CCTALK_REAPPLY_INTERVAL_MS 10000  // Enables are resent this often: a reset before the first
+                                          // event leaves the counter at 0 and cannot be seen
+#define CCTALK_TASK_STACK_SIZE 3072
+#define CCTALK_TASK_CORE 0
+#define CCTALK_TASK_PRIORITY 2            // Above the web server, so polling stays regular
+#define CREDIT_EVENT_QUEUE_LENGTH 8
+
+struct CcTalkDevice {
+  const char* name;
+  uint8_t address;
+  uint8_t acceptor;                       // PulseAcceptor
+  bool online;
+  uint8_t failures;                       // Consecutive failed polls
+  uint8_t eventCounter;                   // Last event counter read, 0 = nothing since device reset
+  unsigned long lastSetupAttempt;
+  uint16_t values[CCTALK_TYPES];          // Per type (index = type - 1): cents for coins, euros for bills, 0 = unknown
+  std::atomic<uint16_t> enableMask;       // Bit n enables type n + 1; written by ccTalkTask() only (ccTalkMaskQueue)
+  uint16_t appliedMask;                   // Mask the device currently has
+  unsigned long lastApply;                // Last time master enable and mask were sent
+  std::atomic<uint32_t> rejected;         // Coins/bills the device rejected or returned
+  std::atomic<uint32_t> lost;             // Events overwritten in the device buffer before we polled
+};
+CcTalkDevice ccTalkCoin = { "Coin acceptor", CCTALK_COIN_ADDRESS, PULSE_ACCEPTOR_COIN };
+CcTalkDevice ccTalkBill = { "Bill validator", CCTALK_BILL_ADDRESS, PULSE_ACCEPTOR_BILL };
+HardwareSerial ccTalkSerial(CCTALK_UART);
+void ccTalkIdle() { vTaskDelay(1); }
+CcTalkBus ccTalkBus(ccTalkSerial, millis, ccTalkIdle, CCTALK_LOCAL_ECHO);
+TaskHandle_t ccTalkTaskHandle = nullptr;
+struct CcTalkMaskRequest {
+  uint8_t acceptor;                       // PulseAcceptor
+  uint16_t mask;
+};
+#define CCTALK_MASK_QUEUE_LENGTH 4
+QueueHandle_t ccTalkMaskQueue = nullptr; // Web handler -> ccTalkTask(): new enable masks
+
+// Coins and bills reported by a serial payment driver, credited by the vending task
+struct CreditEvent {
+  uint8_t acceptor;                       // PulseAcceptor
+  uint8_t type;                           // Device coin/bill type, for the log
+  uint16_t value;                         // Cents for coins, euros for bills
+};
+QueueHandle_t creditEventQueue = nullptr;
+
+// --- Cashless Payment (EC Terminal) ---
+// If the cash credit does not cover the price, '#' starts a card payment for the difference.
+// The vending task only runs the session state machine (waiting -> approved / declined /
+// cancelled, timeout with cancel); the terminal I/O happens in cashlessTask() behind the
+// CashlessProvider interface, so a slow terminal never blocks the keypad or the acceptors.
+#define CASHLESS_TASK_STACK_SIZE 4096
+#define CASHLESS_TASK_CORE 0
+#define CASHLESS_QUEUE_LENGTH 4
+#define CASHLESS_POLL_INTERVAL_MS 50
+#define CASHLESS_SESSION_TIMEOUT_MS 60000   // Customer has this long to present the card
+#define CASHLESS_CANCEL_TIMEOUT_MS 5000     // Terminal must confirm a cancel within this time
+#define CASHLESS_CONNECT_TIMEOUT_MS 2000
+#define CASHLESS_RECONNECT_INTERVAL_MS 5000
+#define CASHLESS_DEFAULT_PORT 9100
+#define CASHLESS_HOST_MAX_LEN 64
+
+enum class CashlessState : uint8_t { IDLE, WAITING, CANCELLING };
+enum class CashlessOutcome : uint8_t { NONE, APPROVED, DECLINED, CANCELLED, FAILED };
+enum class CashlessRequestType : uint8_t { PAY, CANCEL };
+
+struct CashlessSession {
+  CashlessState state;
+  int slot;
+  uint32_t reference;                  // Sent with every request, echoed by the terminal
+  uint16_t amountCents;
+  unsigned long deadline;              // Session timeout, or cancel confirmation while CANCELLING
+  bool timedOut;                       // The cancel was caused by the session timeout
+  bool approved;                       // An approval has been booked for this reference
+};
+CashlessSession cashlessSession = { CashlessState::IDLE, -1, 0, 0, 0, false, false };
+uint32_t cashlessReferenceCounter = 0;     // Seeded randomly at boot: results from before a reboot never match
+
+// Vending task -> cashlessTask()
+struct CashlessRequest {
+  CashlessRequestType type;
+  uint32_t reference;
+  uint16_t amountCents;
+};
+// cashlessTask() -> vending task
+struct CashlessResult {
+  uint32_t reference;
+  CashlessOutcome outcome;
+};
+QueueHandle_t cashlessRequestQueue = nullptr;
+QueueHandle_t cashlessResultQueue = nullptr;
+TaskHandle_t cashlessTaskHandle = nullptr;
+class CashlessProvider;
+CashlessProvider* cashlessProvider = nullptr;
+
+bool cashlessEnabled = false;              // Read through cashlessIsEnabled() once the tasks run
+std::atomic<bool> cashlessOnline(false);   // Terminal reachable, set by cashlessTask()
+SemaphoreHandle_t cashlessConfigMutex = nullptr; // Guards cashlessEnabled / cashlessHost / cashlessPort
+char cashlessHost[CASHLESS_HOST_MAX_LEN] = "";
+uint16_t cashlessPort = CASHLESS_DEFAULT_PORT;
+std::atomic<bool> billGroupOpen(false);  // Bill pulses are arriving, keep the acceptor inhibited
+std::atomic<uint32_t> billPulsesDiscarded(0); // Startup pulses, logged by the vending task
+std::atomic<uint32_t> billPulsesRejected(0);  // Invalid pulse shape (relay spikes), logged by the vending task
+std::atomic<uint32_t> billGroupsLost(0);      // Groups not credited because edge stamps were lost, ditto
+
+
+// --- Buzzer / Tone Sequencer ---
+#define BUZZER_LEDC_CHANNEL 0
+struct ToneNote {
+  uint16_t frequency;  // Hz, 0 = pause
+  uint16_t durationMs;
+};
 
+// Note tables played in the background by the tone sequencer.
+const ToneNote THANK_YOU_MELODY[] = {
+  {2093, 150}, {0, 50}, {2349, 150}, {0, 50}, {2637, 300}, {0, 50}, {2349, 150}, {0, 50},
+  {2093, 150}, {0, 50}, {1975, 300}, {0, 50}, {2093, 400}, {0, 50}
+}; // Notes (C7, D7, E7, ...)
+const ToneNote ERROR_SOUND[]     = { {2500, 150}, {2000, 250} };
+const ToneNote KEY_PRESS_BEEP[]  = { {2800, 50} };
+const ToneNote COIN_ACCEPTED_BEEP[] = { {1200, 100} };
+const ToneNote BILL_ACCEPTED_BEEP[] = { {1000, 150} };
+
+esp_timer_handle_t toneTimer = nullptr;
+portMUX_TYPE toneMux = portMUX_INITIALIZER_UNLOCKED;
+const ToneNote* toneSequence = nullptr;        // Sequence currently playing
+size_t toneSequenceLength = 0;
+size_t toneSequenceIndex = 0;
+const ToneNote* pendingToneSequence = nullptr; // Sequence requested by the main loop
+size_t pendingToneSequenceLength = 0;
+volatile bool tonePlaying = false;
 
 // --- Display Customization ---
 const int SLOGAN_MAX_LENGTH = 24; // Zeichenlimit für den Slogan
@@ -190,9 +635,26 @@ String displaySlogan = "";
 String displayFooter = "www.hanimat.at";
 
 // --- Logging ---
+// Levels: LOG_COMPILE_LEVEL removes everything more verbose at build time (arguments are
+// not even evaluated), logRuntimeLevel filters the rest and is set from the web UI.
+#define LOG_LEVEL_ERROR 0
+#define LOG_LEVEL_WARN  1
+#define LOG_LEVEL_INFO  2
+#define LOG_LEVEL_DEBUG 3
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL LOG_LEVEL_INFO  // Build with -DLOG_COMPILE_LEVEL=3 for keypad/relay debug output
+#endif
+#define LOG_AT(level, ...) do { if ((level) <= LOG_COMPILE_LEVEL) logPrintf((level), __VA_ARGS__); } while (0)
+#define LOG_ERROR(...) LOG_AT(LOG_LEVEL_ERROR, __VA_ARGS__)
+#define LOG_WARN(...)  LOG_AT(LOG_LEVEL_WARN, __VA_ARGS__)
+#define LOG_INFO(...)  LOG_AT(LOG_LEVEL_INFO, __VA_ARGS__)
+#define LOG_DEBUG(...) LOG_AT(LOG_LEVEL_DEBUG, __VA_ARGS__)
 #define MAX_LOG_LINES 50
-String logBuffer[MAX_LOG_LINES];
-int logIndex = 0;
+#define LOG_LINE_LENGTH 160                       // Incl. timestamp, longer lines are truncated
+#define LOG_FETCH_MAX_BYTES 4096                  // Upper bound for one /logdata response
+char logRing[MAX_LOG_LINES][LOG_LINE_LENGTH];      // Static, no heap use
+uint32_t logSequence = 0;                          // Lines written since boot; line n is at (n - 1) % MAX_LOG_LINES
+volatile uint8_t logRuntimeLevel = LOG_LEVEL_INFO;
 
 // --- User Input State ---
 String keypadInputBuffer = "";
@@ -206,14 +668,221 @@ unsigned long lastActivityTimeWeb = 0;
 
 bool displayNeedsUpdate = true;
 
-// --- Dispense Job ---
+// --- Display Widgets (retained mode) ---
+// The idle/selection screen is split into fixed regions. Each region keeps the content it
+// last painted and repaints only its own rectangle when that content changes.
+#define DISPLAY_WIDGET_LINES 3
+#define DISPLAY_WIDGET_TEXT_LEN 40
+enum DisplayRegion { DISPLAY_REGION_HEADER, DISPLAY_REGION_STATUS, DISPLAY_REGION_CREDIT, DISPLAY_REGION_PROMPT,
+                     DISPLAY_REGION_SLOGAN, DISPLAY_REGION_FOOTER, DISPLAY_REGION_COUNT };
+struct WidgetContent {
+  char lines[DISPLAY_WIDGET_LINES][DISPLAY_WIDGET_TEXT_LEN];
+  uint16_t colors[DISPLAY_WIDGET_LINES];  // For DISPLAY_REGION_STATUS: colors[0] is the dot colour, 0 = hidden
+};
+struct DisplayWidget {
+  int16_t x, y, w, h;          // Rectangle owned by the widget
+  const GFXfont* font;
+  int16_t baseline;            // First text baseline, relative to y
+  int16_t lineSpacing;
+  bool centered;               // Centered on the screen width, otherwise at x + 10
+  WidgetContent shown;         // What is on the glass right now
+  bool valid;                  // False forces a repaint
+};
+DisplayWidget displayWidgets[DISPLAY_REGION_COUNT] = {
+  //  x,   y,   w,   h, font,                   baseline, spacing, centered
+  {   0,   0, 292,  52, &Poppins_Black14pt7b,   40,  0,  true  },  // Header
+  { 292,   8,  24,  24, nullptr,                 0,  0,  false },  // Status (WiFi dot)
+  {   0,  62, 320,  26, &Poppins_Regular10pt7b, 18,  0,  false },  // Credit
+  {   0,  92, 320,  76, &Poppins_Regular10pt7b, 18, 25,  false },  // Prompt
+  {   0, 178, 320,  30, &Poppins_Regular10pt7b, 22,  0,  true  },  // Slogan
+  {   0, 212, 320,  28, &Poppins_Regular7pt7b,  14,  0,  true  },  // Footer
+};
+bool displayWidgetsNeedClear = true; // Another screen was drawn over the widgets
+
+// --- Display Pipeline ---
+// The vending task only describes screens (DisplayFrame) and posts them; the display task
+// owns the TFT. It composes each frame into a full-width RAM strip of DISPLAY_STRIP_HEIGHT
+// rows and pushes every strip with one burst, so the glass never shows a cleared area.
+#define DISPLAY_STRIP_HEIGHT 16
+#define DISPLAY_FRAME_QUEUE_LENGTH 4
+#define DISPLAY_OVERLAY_ITEMS 4
+#define DISPLAY_MAX_ITEMS (DISPLAY_REGION_COUNT * DISPLAY_WIDGET_LINES)
+#define DISPLAY_DOT_RADIUS 6
+#define DISPLAY_TASK_CORE 0
+#define DISPLAY_TASK_PRIORITY 1
+#define DISPLAY_TASK_STACK_SIZE 4096
+struct DisplayItem {
+  const GFXfont* font;         // nullptr draws a filled dot centered on (x, baseline)
+  uint16_t color;
+  int16_t x;                   // -1 = centered on the screen width
+  int16_t baseline;
+  char text[DISPLAY_WIDGET_TEXT_LEN];
+};
+enum class DisplayFrameType : uint8_t {
+  WIDGETS,                     // Idle/selection screen, only changed regions are sent
+  OVERLAY                      // Full-screen message (error, dispense, OTA, reset)
+};
+struct DisplayFrame {
+  DisplayFrameType type;
+  WidgetContent widgets[DISPLAY_REGION_COUNT];
+  DisplayItem overlay[DISPLAY_OVERLAY_ITEMS];
+  uint8_t overlayCount;
+};
+QueueHandle_t displayFrameQueue = nullptr;
+TaskHandle_t displayTaskHandle = nullptr;
+GFXcanvas16* stripCanvas = nullptr;
+
+// --- Dispense Queue ---
+// Purchases wait in a ring buffer and are handed out in order. Up to dispenseConcurrency doors
+// are open (or being opened) at once, each with its own timer; the limit keeps the solenoids
+// within the power budget of the supply. The price is taken from credit when a job is queued,
+// so the next item can be bought right away; an aborted job gives it back.
+#define DISPENSE_QUEUE_LENGTH 8
+#define DISPENSE_MAX_CONCURRENCY 4
+enum class DispenseStage : uint8_t {
+  WAITING,        // Queued, door not yet requested
+  RELAY_PENDING,  // Relay write queued, waiting for its I2cResult
+  OPEN,           // Relay confirmed on, sale booked
+  DONE            // Finished or aborted, removed once it reaches the head
+};
 struct DispenseJob {
+  int slot;
+  DispenseStage stage;
+  unsigned long startTime;  // Start of the current stage
+  uint32_t relayTag;
+  uint32_t doorTag;         // Tag of the pending expander door read, a fresh one per read
+  uint16_t cashlessCents;   // Paid by card, the rest comes from credit
+  float price;
+  float reservedCredit;     // Taken from credit when queued
+  float creditBefore;       // Credit before the reservation, for the ledger
+  uint8_t doorSensor;       // Sensor of the slot while OPEN, DOOR_SENSOR_NONE = fixed relay time
+  bool doorReadPending;     // READ_INPUTS queued, waiting for its I2cResult
+  unsigned long lastDoorPoll; // Last GPIO read or queued expander read
+};
+DispenseJob dispenseJobs[DISPENSE_QUEUE_LENGTH];
+uint8_t dispenseHead = 0;   // Oldest job
+uint8_t dispenseCount = 0;  // Jobs in the ring, including DONE ones not yet removed
+uint8_t dispenseConcurrency = 1;
+
+// --- Door Sensors ---
+// Optional door or lock contacts. A slot's sensor is either a free expander pin (one whose relay
+// output is above activeSlots, configured as input) or one of DOOR_SENSOR_GPIOS. With a sensor
+// the relay is released as soon as the door reports open; a door that never opens by the end of
+// DISPENSE_RELAY_ON_TIME flags the sale. Open latency is measured from the confirmed relay write.
+#define DOOR_SENSOR_NONE 0xFF
+#define DOOR_SENSOR_GPIO 0x80        // 0x80 | GPIO number; values below are expander pins (0..127)
+#define DOOR_POLL_INTERVAL_MS 20
+#define DOOR_READ_TIMEOUT_MS 250     // An expander door read not answered by then is sent again
+const uint8_t DOOR_SENSOR_GPIOS[] = { 35, 36, 39 }; // Free input-only pins, need external pull-ups
+uint8_t doorSensors[MAX_SLOTS];
+bool doorOpenHigh = false;
+struct DoorStats {
+  uint16_t opens;
+  uint16_t notOpened;          // Sales where the door never reported open
+  uint16_t minMs;
+  uint16_t maxMs;
+  uint32_t totalMs;
+};
+DoorStats doorStats[MAX_SLOTS]; // Since boot, written by the vending task only
+
+// --- Relay Test Job (web "test relay" actions, run without blocking) ---
+struct RelayTestJob {
   bool active;
+  int slot;               // Slot currently being tested
+  int lastSlot;           // Last slot of the test sequence
+  unsigned long phaseStart;
+  bool relayOn;
+  unsigned long onTime;
+  unsigned long offTime;
+};
+RelayTestJob relayTestJob = { false, -1, -1, 0, false, 0, 0 };
+
+// --- Task Layout ---
+// The customer-facing state machine runs on its own core; WebServer, WiFi and
+// Telegram run on the other one and never touch vending state directly.
+#define VENDING_TASK_CORE 1
+#define VENDING_TASK_PRIORITY 3
+#define VENDING_TASK_STACK_SIZE 8192
+#define NETWORK_TASK_CORE 0
+#define NETWORK_TASK_PRIORITY 1
+#define NETWORK_TASK_STACK_SIZE 8192
+TaskHandle_t vendingTaskHandle = nullptr;
+TaskHandle_t networkTaskHandle = nullptr;
+
+// --- Vending Task Events ---
+// The vending task sleeps in xTaskNotifyWait() until one of these bits is set
+// by an ISR, an esp_timer or the network side.
+#define VENDING_EVENT_COIN_PULSE    (1UL << 0)
+#define VENDING_EVENT_BILL_PULSE    (1UL << 1)
+#define VENDING_EVENT_KEYPAD_WAKE   (1UL << 2)  // Column edge while the keypad is idle
+#define VENDING_EVENT_KEYPAD_SCAN   (1UL << 3)  // Periodic scan tick while a key is active
+#define VENDING_EVENT_DEADLINE      (1UL << 4)  // Nearest pending timeout reached
+#define VENDING_EVENT_COMMAND       (1UL << 5)  // Web command or TFT message queued
+#define VENDING_EVENT_RESET_BUTTON  (1UL << 6)  // Reset button pressed (resetButtonPressTime)
+#define VENDING_EVENT_CREDIT        (1UL << 7)  // creditEventQueue has entries
+#define VENDING_EVENT_CASHLESS      (1UL << 8)  // cashlessResultQueue has entries
+#define VENDING_EVENT_RELAY         (1UL << 9)  // relayResultQueue has entries
+#define KEYPAD_SCAN_INTERVAL_MS 20
+esp_timer_handle_t keypadScanTimer = nullptr;
+esp_timer_handle_t vendingDeadlineTimer = nullptr;
+bool keypadScanning = false;
+#define FACTORY_RESET_HOLD_MS 7000
+volatile unsigned long resetButtonPressTime = 0; // millis() of the last press, set by resetButtonISR()
+bool resetButtonHeld = false;                    // Hold is being timed by the vending task
+
+// --- Cross-Core Communication ---
+// Web handlers post commands; the vending task applies and persists them.
+enum class VendingCommandType : uint8_t {
+  SET_PRICE,
+  REFILL_SLOT,
+  REFILL_ALL,
+  ADJUST_CREDIT,
+  RESET_CREDIT,
+  TOGGLE_SLOT_LOCK,
+  SET_ACTIVE_SLOTS,
+  TEST_RELAY,
+  TEST_ALL_RELAYS,
+  RELOAD_DISPLAY_TEXTS,
+  FLUSH_SETTINGS,
+  SET_COIN_PULSE_VALUE,   // slot = pulse count, value = euros (0 = not accepted)
+  SET_BILL_PULSE_VALUE,
+  START_PULSE_LEARN,      // slot = PulseAcceptor, value = euros of the denomination to insert
+  STOP_PULSE_LEARN,
+  CONFIRM_PULSE_LEARN,    // Overwrite the table entry of the group held back
+  APPLY_LEARNED_TIMEOUTS,
+  SET_DOOR_SENSOR,        // value = sensor (DOOR_SENSOR_NONE / DOOR_SENSOR_GPIO | gpio / expander pin)
+  SET_DOOR_OPEN_LEVEL     // value = 1: input HIGH means open
+};
+struct VendingCommand {
+  VendingCommandType type;
   int slot;
-  unsigned long startTime;
-  bool relayActivated;
+  float value;
+};
+#define VENDING_COMMAND_QUEUE_LENGTH 16
+QueueHandle_t vendingCommandQueue = nullptr;
+
+// Messages for the TFT from the network side (e.g. OTA progress). Single slot, newest wins.
+struct TftMessage {
+  char line1[40];
+  char line2[40];
+  char line3[40];
+  uint16_t color;
+};
+QueueHandle_t tftMessageQueue = nullptr;
+unsigned long lastTftMessageTime = 0;
+
+// Read-only copy of the vending state for the web UI, published by the vending task (seqlock).
+struct VendingSnapshot {
+  float credit;
+  int activeSlots;
+  float slotPrices[MAX_SLOTS];
+  bool slotAvailable[MAX_SLOTS];
+  bool slotLocked[MAX_SLOTS];
+  bool dispenseActive;
+  int dispenseSlot;
 };
-DispenseJob dispenseJob = { false, -1, 0, false };
+VendingSnapshot vendingSnapshot;
+std::atomic<uint32_t> vendingSnapshotSeq(0);
 
 // --- OTA Update ---
 String otaStatusMessage = "";
@@ -225,21 +894,82 @@ String telegramBotToken = ""; // Placeholder for Telegram Bot Token
 String telegramChatId = "";   // Placeholder for Telegram Chat ID
 UniversalTelegramBot bot(telegramBotToken, secured_client);
 
+// --- Telegram Outbound Queue ---
+// Producers only enqueue; a worker task on the other core does the HTTPS call.
+#define TELEGRAM_QUEUE_LENGTH 8
+#define TELEGRAM_MESSAGE_MAX_LEN 256
+#define TELEGRAM_MAX_ATTEMPTS 4
+#define TELEGRAM_RETRY_BASE_DELAY_MS 2000   // Doubled after every failed attempt
+#define TELEGRAM_TASK_STACK_SIZE 8192       // TLS handshake needs a large stack
+#define TELEGRAM_TASK_CORE 0                // Arduino loop() runs on core 1
+struct TelegramOutboundMessage {
+  char text[TELEGRAM_MESSAGE_MAX_LEN];
+};
+QueueHandle_t telegramQueue = nullptr;
+TaskHandle_t telegramTaskHandle = nullptr;
+SemaphoreHandle_t telegramConfigMutex = nullptr; // Guards telegramBotToken / telegramChatId
+volatile uint32_t telegramMessagesSent = 0;
+volatile uint32_t telegramMessagesFailed = 0;  // Gave up after TELEGRAM_MAX_ATTEMPTS
+volatile uint32_t telegramMessagesDropped = 0; // Queue full
+volatile uint32_t telegramRetries = 0;
+
+// --- Logging Lock ---
+SemaphoreHandle_t logMutex = nullptr; // logPrintf() is called from several tasks
+
 
 // =================================================================
 //                      FUNCTION PROTOTYPES
 // =================================================================
 void setupWebServer();
 void updateDisplayScreen();
+void updateDisplayWidget(DisplayRegion region, const WidgetContent& content);
+void invalidateDisplayWidgets();
+void displayTask(void* parameter);
+void postDisplayFrame(const DisplayFrame& frame);
+void beginDisplayOverlay(DisplayFrame& frame);
+void addOverlayItem(DisplayFrame& frame, const GFXfont* font, uint16_t color, int16_t x, int16_t baseline, const char* format, ...)
+  __attribute__((format(printf, 6, 7)));
 char manualGetKeyState();
 void processKeypad();
 void processKeypadSelection();
-void scheduleDispense(int slot);
-void processDispenseJob();
-bool controlSlotRelay(int slot, bool activate);
+int slotNumberDigits();
+bool scheduleDispense(int slot, uint16_t cashlessCents = 0);
+DispenseJob& dispenseJobAt(int index);
+bool dispenseQueueBusy();
+bool dispenseQueueFull();
+void processDispenseJobs();
+bool controlSlotRelay(int slot, bool activate, uint32_t tag = 0);
+int relaySlotCount();
+void initI2cBus();
+void initRelayExpanders();
+bool probeRelayExpander(int expander, int attempts);
+void addRelayExpander();
+bool setSlotRelay(int slot, bool activate);
+bool commitRelayOutputs(uint32_t tag = 0);
+void processRelayResults();
+void abortDispenseJob(DispenseJob& job);
+void completeDispensePurchase(DispenseJob& job, bool doorUnconfirmed = false);
+void startDispenseOpen(DispenseJob& job);
+void pollDoorSensor(DispenseJob& job, unsigned long now);
+bool doorLevelIsOpen(bool levelHigh);
+void finishDoorOpened(DispenseJob& job, unsigned long sampledAt);
+void finishDoorNotOpened(DispenseJob& job);
 void processBillAcceptorPulses();
 void resetDisplayToDefault();
 void processAcceptedCoin();
+void creditCoinCents(int cents);
+void creditBillEuros(int euros);
+void processCreditEvents();
+void initCcTalk();
+void ccTalkTask(void* parameter);
+bool cashlessIsEnabled();
+bool cashlessAvailable();
+void startCashlessSession(int slot);
+void cancelCashlessSession();
+void processCashlessSession();
+void bookLateCashlessApproval();
+void initCashless();
+void cashlessTask(void* parameter);
 void handleLogDataRequest();
 void displayOTAMessageTFT(String line1, String line2 = "", String line3 = "", uint16_t color = ILI9341_ORANGE);
 void checkOverallStockLevel();
@@ -247,131 +977,330 @@ void checkOverallStockLevel();
 // Web Server Handlers
 void handleRoot();
 void handleLogin();
-void handleChangePasswordWeb();
-void handleUpdatePriceWeb();
-void handleRefillWeb();
-void handleAddCreditWeb();
-void handleResetCreditWeb();
-void handleRefillAllWeb();
-void handleTriggerRelayWeb();
-void handleTriggerAllRelaysWeb();
-void handleSetStaticIPWeb();
-void handleUpdateSlotsWeb();
-void handleToggleSlotLockWeb();
-void handleOTAUpdatePage();
-void handleOTAUpdateUpload();
 void handleOTAFileUpload();
-void handleTimingConfigPage();
-void handleSaveTimingConfig();
-void handleTelegramConfigPage();
-void handleSaveTelegramConfig();
-void handleSendTestTelegram();
-void handleDisplayConfigPage();
-void handleSaveDisplayConfig();
+bool requireApiAuth();
+void sendApiResult(int code, const char* error, const char* message = nullptr);
+void handleApiState();
+void handleApiConfig();
+void handleApiCredit();
+void handleApiSlotPrice();
+void handleApiSlotRefill();
+void handleApiSlotLock();
+void handleApiSlotTest();
+void handleApiSlotCount();
+void handleApiTimingConfig();
+void handleApiTelegramConfig();
+void handleApiDisplayConfig();
+void handleApiNetworkConfig();
+void handleApiPassword();
+void handleApiLogLevel();
+void handleApiTelegramTest();
+void handleApiPaymentTable();
+void handleApiPaymentLearn();
+void handleApiPaymentLearnApply();
+void handleApiPaymentInhibit();
+void handleApiCashlessConfig();
+void handleApiDoors();
+void handleApiDoorConfig();
 
 // HTML Page Generators
 void showLoginPage();
-void showDashboard();
+void showAdminApp();
+
+// Task & Cross-Core Functions
+void vendingTask(void* parameter);
+void notifyVendingTask(uint32_t events);
+void keypadScanTimerCallback(void* arg);
+void initPulseCounters();
+void pulsePollTimerCallback(void* arg);
+void vendingDeadlineTimerCallback(void* arg);
+void startKeypadScanning();
+void stopKeypadScanning();
+void armVendingDeadlineTimer();
+void checkFactoryResetButton();
+void networkTask(void* parameter);
+void publishVendingSnapshot();
+VendingSnapshot readVendingSnapshot();
+bool postVendingCommand(VendingCommandType type, int slot = -1, float value = 0.0f);
+void processVendingCommands();
+void startRelayTest(int firstSlot, int lastSlot, unsigned long onTime, unsigned long offTime);
+void processRelayTestJob();
+void postTftMessage(const char* line1, const char* line2 = "", const char* line3 = "", uint16_t color = ILI9341_ORANGE);
+void processTftMessages();
+
+// Settings Cache & Journal
+void markCreditChanged();
+void markSlotTableChanged();
+bool settingsCacheDirty();
+void commitSettingsCache();
+void processSettingsCache();
+void initMoneyJournal();
+void appendMoneyJournal();
+void eraseMoneyJournal();
+void journalEraseTask(void* parameter);
+void enterJournalSector();
+void queueJournalPreErase();
+uint32_t journalRecordCrc(const JournalRecord& record);
+void loadSlotTable();
+void initSalesLedger();
+void recordSale(int slot, float price, float creditBefore, float creditAfter, bool cashless = false, bool doorUnconfirmed = false);
+void ledgerWriterTask(void* parameter);
+uint32_t ledgerOffsetForSequence(uint32_t sequence);
+bool readLedgerRecord(uint32_t sequence, LedgerRecord& record);
+void handleSalesDataRequest();
+void saveSlotTable();
+bool migrateLegacySlotKeys();
+void loadPulseTables();
+void savePulseTables();
+void loadDoorSensors();
+void saveDoorSensors();
+void applyDoorSensors();
+bool doorSensorUsable(uint8_t sensor);
+uint16_t pulseTableUnits(int acceptor, float euros);
+void learnPulseGroup(const PulseGroupEvent& group);
+void storeLearnedGroup(int pulses, uint32_t maxIntervalUs);
+void stopPulseLearn();
+unsigned long learnedGroupTimeoutMs(int acceptor);
+void applyLearnedTimeouts();
 
 // Utility Functions
 int countAvailableSlots();
+int countAvailableSlots(const VendingSnapshot& snap);
 int countEmptySlots();
 void displayErrorMessage(const String &line1, const String &line2 = "");
 void playThankYouMelody();
 void playErrorSound();
 void playKeyPressBeep();
-void logMessage(const String& msg);
+void playToneSequence(const ToneNote* notes, size_t count);
+bool isTonePlaying();
+void toneTimerCallback(void* arg);
+void logPrintf(uint8_t level, const char* format, ...) __attribute__((format(printf, 2, 3)));
 bool checkRelayBoardOnline();
 void sendTelegramMessage(String message);
+void telegramWorkerTask(void* parameter);
+uint32_t getTelegramQueueDepth();
 
 // Interrupt Service Routines
 void IRAM_ATTR coinAcceptorISR();
 void IRAM_ATTR billAcceptorISR();
+void IRAM_ATTR keypadWakeISR();
+void IRAM_ATTR resetButtonISR();
+void IRAM_ATTR notifyVendingTaskFromISR(uint32_t events);
 
 // =================================================================
 //                      HELPER FUNCTIONS
 // =================================================================
 
 /**
- * @brief Logs a message to the Serial port and a circular buffer for the web UI.
- * @param msg The message string to log.
+ * @brief Formats a log line into the static ring buffer for the web UI and prints it to Serial.
+ *        Use the LOG_ERROR/LOG_WARN/LOG_INFO/LOG_DEBUG macros instead of calling this directly.
+ * @param level One of LOG_LEVEL_*. Lines above logRuntimeLevel are discarded before formatting.
  */
-void logMessage(const String& msg) {
-  Serial.println(msg);
-  logBuffer[logIndex] = "[" + String(millis() / 1000) + "s] " + msg;
-  logIndex = (logIndex + 1) % MAX_LOG_LINES;
+void logPrintf(uint8_t level, const char* format, ...) {
+  if (level > logRuntimeLevel) return;
+  static const char* const levelPrefix[] = { "ERROR: ", "WARNING: ", "", "DEBUG: " };
+
+  if (logMutex) xSemaphoreTake(logMutex, portMAX_DELAY);
+  char* line = logRing[logSequence % MAX_LOG_LINES];
+  int prefixLength = snprintf(line, LOG_LINE_LENGTH, "[%lus] %s", (unsigned long)(millis() / 1000), levelPrefix[level]);
+  va_list args;
+  va_start(args, format);
+  vsnprintf(line + prefixLength, LOG_LINE_LENGTH - prefixLength, format, args);
+  va_end(args);
+  Serial.println(line);
+  logSequence++;
+  if (logMutex) xSemaphoreGive(logMutex);
 }
 
 /**
- * @brief Plays a "Thank You" melody on the buzzer.
+ * @brief Timer callback of the tone sequencer. Plays the current note and re-arms the timer
+ *        for the next one. Runs in the esp_timer task, so loop() never waits for the buzzer.
  */
-void playThankYouMelody() {
-  int melody[] = { 2093, 2349, 2637, 2349, 2093, 1975, 2093 }; // Notes (C7, D7, E7, ...)
-  int noteDurations[] = { 150, 150, 300, 150, 150, 300, 400 };
-  for (int i = 0; i < sizeof(melody)/sizeof(melody[0]); i++) {
-    ledcWriteTone(0, melody[i]);
-    delay(noteDurations[i]);
-    ledcWriteTone(0, 0); // Stop tone
-    delay(50);
+void toneTimerCallback(void* arg) {
+  uint16_t frequency = 0;
+  uint16_t durationMs = 0;
+
+  portENTER_CRITICAL(&toneMux);
+  if (pendingToneSequence != nullptr) { // A new sequence replaces the running one
+    toneSequence = pendingToneSequence;
+    toneSequenceLength = pendingToneSequenceLength;
+    toneSequenceIndex = 0;
+    pendingToneSequence = nullptr;
+  }
+  if (toneSequence != nullptr && toneSequenceIndex < toneSequenceLength) {
+    frequency = toneSequence[toneSequenceIndex].frequency;
+    durationMs = toneSequence[toneSequenceIndex].durationMs;
+    toneSequenceIndex++;
+  } else {
+    toneSequence = nullptr;
+    tonePlaying = false;
+  }
+  portEXIT_CRITICAL(&toneMux);
+
+  ledcWriteTone(BUZZER_LEDC_CHANNEL, frequency);
+  if (durationMs > 0) {
+    esp_timer_start_once(toneTimer, (uint64_t)durationMs * 1000ULL);
   }
 }
 
 /**
- * @brief Plays a descending two-tone error sound on the buzzer.
+ * @brief Starts playing a note table in the background and returns immediately.
+ *        A sequence that is still playing is replaced.
+ * @param notes The note table (must stay valid while playing, e.g. a global const array).
+ * @param count Number of notes in the table.
+ */
+void playToneSequence(const ToneNote* notes, size_t count) {
+  if (toneTimer == nullptr || notes == nullptr || count == 0) return;
+
+  portENTER_CRITICAL(&toneMux);
+  pendingToneSequence = notes;
+  pendingToneSequenceLength = count;
+  tonePlaying = true;
+  portEXIT_CRITICAL(&toneMux);
+
+  // Fire the callback right away; it picks up the pending sequence.
+  esp_timer_stop(toneTimer);
+  esp_timer_start_once(toneTimer, 1);
+}
+
+/**
+ * @brief Checks whether the tone sequencer is currently playing.
+ * @return True while a sequence is playing.
+ */
+bool isTonePlaying() {
+  return tonePlaying;
+}
+
+/**
+ * @brief Plays a "Thank You" melody on the buzzer (non-blocking).
+ */
+void playThankYouMelody() {
+  playToneSequence(THANK_YOU_MELODY, sizeof(THANK_YOU_MELODY) / sizeof(THANK_YOU_MELODY[0]));
+}
+
+/**
+ * @brief Plays a descending two-tone error sound on the buzzer (non-blocking).
  */
 void playErrorSound() {
-  ledcWriteTone(0, 2500);
-  delay(150);
-  ledcWriteTone(0, 2000);
-  delay(250);
-  ledcWriteTone(0, 0); // Stop tone
+  playToneSequence(ERROR_SOUND, sizeof(ERROR_SOUND) / sizeof(ERROR_SOUND[0]));
 }
 
 /**
- * @brief Plays a short beep sound for keypad presses.
+ * @brief Plays a short beep sound for keypad presses (non-blocking).
  */
 void playKeyPressBeep() {
-  ledcWriteTone(0, 2800);
-  delay(50);
-  ledcWriteTone(0, 0); // Stop tone
+  playToneSequence(KEY_PRESS_BEEP, sizeof(KEY_PRESS_BEEP) / sizeof(KEY_PRESS_BEEP[0]));
 }
 
 /**
- * @brief Checks if the I2C relay expander board is connected and responsive.
- * @return True if the board acknowledges its address, false otherwise.
+ * @brief Checks if all relay expanders found so far are connected and responsive, using the
+ *        board state cached by i2cTask() (no bus access).
+ * @return True if the last transaction succeeded and is recent enough, false otherwise.
  */
 bool checkRelayBoardOnline() {
-  Wire.beginTransmission(RELAY_I2C_ADDRESS);
-  byte error = Wire.endTransmission();
-  if (error != 0) {
-    logMessage("ERROR: Relay board I2C not reachable (Addr: 0x" + String(RELAY_I2C_ADDRESS, HEX) + ", Code: " + String(error) + ")");
+  if (!relayBoardOnline) {
+    LOG_ERROR("Relay board offline.");
+    return false;
+  }
+  if (millis() - relayBoardLastSeen > RELAY_HEALTH_STALE_MS) {
+    LOG_ERROR("Relay board state is stale (I2C task not responding).");
+    return false;
   }
-  return (error == 0);
+  return true;
 }
 
 /**
- * @brief Sends a message via Telegram if enabled and configured.
+ * @brief Queues a message for Telegram if enabled and configured. Returns immediately;
+ *        the actual HTTPS request is made by telegramWorkerTask().
  * @param message The message string to send.
  */
 void sendTelegramMessage(String message) {
   if (!telegramEnabled) {
-    logMessage("Telegram: Notifications are disabled.");
+    LOG_INFO("Telegram: Notifications are disabled.");
     return;
   }
   bool offlineMode = (digitalRead(OFFLINE_MODE_PIN) == LOW);
-  if (offlineMode || WiFi.status() != WL_CONNECTED) {
-    logMessage("Telegram: Offline, message not sent.");
+  if (offlineMode) {
+    LOG_INFO("Telegram: Offline mode, message not sent.");
+    return;
+  }
+  if (telegramQueue == nullptr) {
+    LOG_ERROR("Telegram queue not initialized. Message not sent.");
     return;
   }
-  if (telegramBotToken.length() > 0 && telegramChatId.length() > 0) {
-    logMessage("Sending Telegram message: " + message);
-    if(bot.sendMessage(telegramChatId, message, "")) { // Empty parse mode for emojis
-      logMessage("Telegram message sent successfully.");
+
+  TelegramOutboundMessage outbound;
+  strncpy(outbound.text, message.c_str(), TELEGRAM_MESSAGE_MAX_LEN - 1);
+  outbound.text[TELEGRAM_MESSAGE_MAX_LEN - 1] = '\0';
+
+  if (xQueueSend(telegramQueue, &outbound, 0) == pdTRUE) {
+    LOG_INFO("Telegram: Message queued (%u pending).", (unsigned)getTelegramQueueDepth());
+  } else {
+    telegramMessagesDropped++;
+    LOG_ERROR("Telegram queue full, message dropped. Dropped total: %u", (unsigned)telegramMessagesDropped);
+  }
+}
+
+/**
+ * @brief Returns the number of Telegram messages waiting to be sent.
+ */
+uint32_t getTelegramQueueDepth() {
+  return (telegramQueue != nullptr) ? (uint32_t)uxQueueMessagesWaiting(telegramQueue) : 0;
+}
+
+/**
+ * @brief Background task that drains the Telegram queue. Runs on TELEGRAM_TASK_CORE and
+ *        owns the bot/TLS client, retrying failed sends with exponential backoff.
+ */
+void telegramWorkerTask(void* parameter) {
+  TelegramOutboundMessage outbound;
+  String activeToken = "";
+
+  for (;;) {
+    if (xQueueReceive(telegramQueue, &outbound, portMAX_DELAY) != pdTRUE) continue;
+
+    bool sent = false;
+    unsigned long retryDelay = TELEGRAM_RETRY_BASE_DELAY_MS;
+    for (int attempt = 1; attempt <= TELEGRAM_MAX_ATTEMPTS && !sent; attempt++) {
+      if (attempt > 1) {
+        telegramRetries++;
+        vTaskDelay(pdMS_TO_TICKS(retryDelay));
+        retryDelay *= 2;
+      }
+
+      // Copy the configuration so the web handlers can change it at any time
+      xSemaphoreTake(telegramConfigMutex, portMAX_DELAY);
+      String token = telegramBotToken;
+      String chatId = telegramChatId;
+      xSemaphoreGive(telegramConfigMutex);
+
+      if (token.length() == 0 || chatId.length() == 0) {
+        LOG_WARN("Telegram Bot Token or Chat ID not configured. Message discarded.");
+        break;
+      }
+      if (WiFi.status() != WL_CONNECTED) {
+        LOG_WARN("Telegram: WiFi not connected (attempt %d/%d).", attempt, TELEGRAM_MAX_ATTEMPTS);
+        continue;
+      }
+      if (token != activeToken) {
+        bot.updateToken(token);
+        activeToken = token;
+      }
+
+      LOG_INFO("Sending Telegram message: %s", outbound.text);
+      if (bot.sendMessage(chatId, String(outbound.text), "")) { // Empty parse mode for emojis
+        sent = true;
+      } else {
+        LOG_ERROR("Failed to send Telegram message (attempt %d/%d).", attempt, TELEGRAM_MAX_ATTEMPTS);
+      }
+    }
+
+    if (sent) {
+      telegramMessagesSent++;
+      LOG_INFO("Telegram message sent successfully.");
     } else {
-      logMessage("ERROR: Failed to send Telegram message.");
+      telegramMessagesFailed++;
     }
-  } else {
-    logMessage("WARNING: Telegram Bot Token or Chat ID not configured. Cannot send message.");
   }
 }
 
@@ -383,38 +1312,17 @@ void sendTelegramMessage(String message) {
  * @param color Color for the first line.
  */
 void displayOTAMessageTFT(String line1, String line2, String line3, uint16_t color) {
-  tft.fillScreen(ILI9341_BLACK);
-  tft.setTextWrap(true);
-  int16_t x1, y1;
-  uint16_t w, h;
+  static DisplayFrame frame; // Only used by the vending task
+  beginDisplayOverlay(frame);
 
   // Title
-  tft.setFont(&Poppins_Black14pt7b);
-  tft.setTextColor(ILI9341_YELLOW);
-  tft.getTextBounds("HANIMAT", 0, 0, &x1, &y1, &w, &h);
-  tft.setCursor((tft.width() - w) / 2, 40);
-  tft.println("HANIMAT");
+  addOverlayItem(frame, &Poppins_Black14pt7b, ILI9341_YELLOW, -1, 40, "HANIMAT");
 
   // Message Lines
-  tft.setFont(&Poppins_Regular10pt7b);
-  tft.setTextColor(color);
-  tft.getTextBounds(line1, 0, 0, &x1, &y1, &w, &h);
-  tft.setCursor((tft.width() - w) / 2, 90);
-  tft.println(line1);
-
-  if (line2.length() > 0) {
-    tft.setTextColor(ILI9341_WHITE);
-    tft.getTextBounds(line2, 0, 0, &x1, &y1, &w, &h);
-    tft.setCursor((tft.width() - w) / 2, 120);
-    tft.println(line2);
-  }
-  
-  if (line3.length() > 0) {
-    tft.setTextColor(ILI9341_WHITE);
-    tft.getTextBounds(line3, 0, 0, &x1, &y1, &w, &h);
-    tft.setCursor((tft.width() - w) / 2, 150);
-    tft.println(line3);
-  }
+  addOverlayItem(frame, &Poppins_Regular10pt7b, color, -1, 90, "%s", line1.c_str());
+  if (line2.length() > 0) addOverlayItem(frame, &Poppins_Regular10pt7b, ILI9341_WHITE, -1, 120, "%s", line2.c_str());
+  if (line3.length() > 0) addOverlayItem(frame, &Poppins_Regular10pt7b, ILI9341_WHITE, -1, 150, "%s", line3.c_str());
+  postDisplayFrame(frame);
 }
 
 // =================================================================
@@ -422,25 +1330,67 @@ void displayOTAMessageTFT(String line1, String line2, String line3, uint16_t col
 // =================================================================
 
 /**
- * @brief ISR for the coin acceptor. Increments a pulse counter.
+ * @brief Starts the pulse poll timer unless it is already running. Called by the first edge of
+ *        a group (ISR) and by the poll timer itself when edges raced its stop.
+ */
+static inline void IRAM_ATTR startPulsePolling() {
+  if (!pulsePollActive.exchange(true)) esp_timer_start_periodic(pulsePollTimer, PULSE_POLL_INTERVAL_MS * 1000ULL);
+}
+
+/**
+ * @brief Stores the time of a pulse edge and makes sure the group gets polled. If the ring is
+ *        full the stamp is dropped and counted; the PCNT still counts the pulse.
+ */
+static inline void IRAM_ATTR pushPulseStamp(PulseRing& ring, uint32_t stamp) {
+  uint32_t head = ring.head.load(std::memory_order_relaxed);
+  if (head - ring.tail.load(std::memory_order_acquire) >= PULSE_RING_SIZE) {
+    ring.dropped.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    ring.stamps[head % PULSE_RING_SIZE] = stamp;
+    ring.head.store(head + 1, std::memory_order_release);
+  }
+  startPulsePolling();
+}
+
+/**
+ * @brief ISR for the coin acceptor (rising edge). Time-stamps the edge, counting is done by the PCNT.
  */
 void IRAM_ATTR coinAcceptorISR() {
-  coinPulseCount++;
-  lastCoinPulseTime = millis();
+  pushPulseStamp(coinPulseRing, (uint32_t)esp_timer_get_time());
 }
 
 /**
- * @brief ISR for the bill acceptor. Increments a pulse counter with debouncing.
+ * @brief ISR for the bill acceptor (both edges). Time-stamps the edge together with the new level.
  */
 void IRAM_ATTR billAcceptorISR() {
-  unsigned long currentMillis = millis();
-  if (currentMillis < STARTUP_IGNORE_BILL_TIME) return; // Ignore pulses at startup
+  uint32_t level = digitalRead(BILL_ACCEPTOR_PIN) == HIGH ? 1 : 0;
+  pushPulseStamp(billPulseRing, ((uint32_t)esp_timer_get_time() & ~1UL) | level);
+}
 
-  if (currentMillis - lastBillDebounceEdgeTime > BILL_ISR_DEBOUNCE_MS) {
-    billAcceptorPulseCount++;
-    lastBillPulseEdgeTime = currentMillis;
-    lastBillDebounceEdgeTime = currentMillis;
-  }
+/**
+ * @brief ISR for the keypad columns while all rows are driven HIGH (idle). Wakes the vending task.
+ */
+void IRAM_ATTR keypadWakeISR() {
+  notifyVendingTaskFromISR(VENDING_EVENT_KEYPAD_WAKE);
+}
+
+/**
+ * @brief ISR for the factory reset button. Stamps the press and wakes the vending task, which
+ *        times the hold with a deadline.
+ */
+void IRAM_ATTR resetButtonISR() {
+  resetButtonPressTime = millis();
+  notifyVendingTaskFromISR(VENDING_EVENT_RESET_BUTTON);
+}
+
+/**
+ * @brief Sets event bits on the vending task from interrupt context.
+ */
+void IRAM_ATTR notifyVendingTaskFromISR(uint32_t events) {
+  if (vendingTaskHandle == nullptr) return; // Pulses before start are handled on the first pass
+  BaseType_t higherPriorityTaskWoken = pdFALSE;
+  xTaskNotifyFromISR(vendingTaskHandle, events, eSetBits, &higherPriorityTaskWoken);
+  if (higherPriorityTaskWoken) portYIELD_FROM_ISR();
 }
 
 // =================================================================
@@ -449,52 +1399,35 @@ void IRAM_ATTR billAcceptorISR() {
 void setup() {
   Serial.begin(115200);
   delay(100);
+  logMutex = xSemaphoreCreateMutex();
   Serial.println();
-  logMessage("System starting: HANIMAT " + FIRMWARE_VERSION);
+  LOG_INFO("System starting: HANIMAT %s", FIRMWARE_VERSION.c_str());
   bootTime = millis();
 
-// --- Initialize I2C ---
-  Wire.begin();
-  Wire.setClock(50000L); // Set I2C clock to 50kHz for stability
-  logMessage("I2C clock set to 50kHz.");
-  delay(100); // Allow I2C bus to stabilize
-
-  // --- Initialize Relay Expander Board (EARLY to prevent race condition) ---
-  // This is done immediately after I2C initialization to ensure relay
-  // pins are in a defined state (OFF) as quickly as possible.
-  expanderOutputStates[0] = 0x0000;
-
-  // OPTIMIERUNG:
-  // 1. Zuerst die Output-Register auf LOW setzen (während die Pins noch Inputs sind).
-  //    Das verhindert das "Klackern" beim Starten.
-  // 2. Sequential Write nutzen (2 Bytes auf einmal) für weniger Overhead.
-  
-  logMessage("Setting relay output latches to OFF (pre-config)...");
-  Wire.beginTransmission(RELAY_I2C_ADDRESS);
-  Wire.write(0x02); // Start bei Register 0x02 (Output Port 0)
-  Wire.write(0x00); // Port 0 auf LOW
-  Wire.write(0x00); // Port 1 auf LOW (Chip inkrementiert automatisch zu Reg 0x03)
-  Wire.endTransmission();
-
-  logMessage("Configuring Relay Board pins as OUTPUT...");
-  Wire.beginTransmission(RELAY_I2C_ADDRESS);
-  Wire.write(0x06); // Start bei Register 0x06 (Configuration Port 0)
-  Wire.write(0x00); // Port 0 auf OUTPUT
-  Wire.write(0x00); // Port 1 auf OUTPUT (Chip inkrementiert automatisch zu Reg 0x07)
-  Wire.endTransmission();
-
-  logMessage("Relay board initialized (Fast Mode).");
+// --- Initialize I2C and Relay Expander Boards (EARLY to prevent race condition) ---
+  // The I2C task configures the expanders first thing, so relay pins are in a
+  // defined state (OFF) as quickly as possible. setup() waits for it.
+  initI2cBus();
 
   // --- Initialize Telegram Client ---
   secured_client.setInsecure(); // Allow connections without certificate validation
-  logMessage("Telegram client set to 'insecure' mode.");
+  LOG_INFO("Telegram client set to 'insecure' mode.");
 
   // --- Initialize Buzzer ---
   pinMode(BUZZER_PIN, OUTPUT);
   digitalWrite(BUZZER_PIN, LOW);
-  ledcSetup(0, 2000, 8); // Setup LEDC channel 0
-  ledcAttachPin(BUZZER_PIN, 0);
-  ledcWriteTone(0, 0); // Ensure buzzer is off
+  ledcSetup(BUZZER_LEDC_CHANNEL, 2000, 8); // Setup LEDC channel 0
+  ledcAttachPin(BUZZER_PIN, BUZZER_LEDC_CHANNEL);
+  ledcWriteTone(BUZZER_LEDC_CHANNEL, 0); // Ensure buzzer is off
+
+  // Tone sequencer timer (plays melodies in the background)
+  esp_timer_create_args_t toneTimerArgs = {};
+  toneTimerArgs.callback = &toneTimerCallback;
+  toneTimerArgs.name = "tone";
+  if (esp_timer_create(&toneTimerArgs, &toneTimer) != ESP_OK) {
+    LOG_ERROR("Could not create tone sequencer timer.");
+    toneTimer = nullptr;
+  }
 
   // --- Initialize GPIO Pins ---
   pinMode(WIFI_RESET_BUTTON, INPUT_PULLUP);
@@ -511,15 +1444,32 @@ void setup() {
   for (int i = 0; i < KEYPAD_COLS; i++) {
     pinMode(colPins[i], INPUT); // Assumes external pull-down resistors
   }
-  logMessage("Keypad pins configured for manual scan with external pull-downs.");
+  LOG_INFO("Keypad pins configured for manual scan with external pull-downs.");
+
+  // Scan timer only runs while a key is active; otherwise a column edge wakes the vending task.
+  esp_timer_create_args_t keypadTimerArgs = {};
+  keypadTimerArgs.callback = &keypadScanTimerCallback;
+  keypadTimerArgs.name = "keypad";
+  esp_timer_create(&keypadTimerArgs, &keypadScanTimer);
+
+  esp_timer_create_args_t deadlineTimerArgs = {};
+  deadlineTimerArgs.callback = &vendingDeadlineTimerCallback;
+  deadlineTimerArgs.name = "vending";
+  esp_timer_create(&deadlineTimerArgs, &vendingDeadlineTimer);
+
+  stopKeypadScanning(); // Rows HIGH, wait for a column edge
+  for (int i = 0; i < KEYPAD_COLS; i++) {
+    attachInterrupt(digitalPinToInterrupt(colPins[i]), keypadWakeISR, RISING);
+  }
+  attachInterrupt(digitalPinToInterrupt(WIFI_RESET_BUTTON), resetButtonISR, FALLING);
 
   // --- Load Settings from Preferences ---
   preferences.begin("hanimat", false);
-  logMessage("Loading settings from Preferences...");
+  LOG_INFO("Loading settings from Preferences...");
   COIN_PROCESSING_DELAY = preferences.getULong("coinDelay", 150);
-  BILL_ISR_DEBOUNCE_MS = preferences.getULong("billIsrDeb", 75);
   BILL_GROUP_PROCESSING_TIMEOUT_MS = preferences.getULong("billGrpTout", 1500);
   DISPENSE_RELAY_ON_TIME = preferences.getULong("dispTime", 5000);
+  dispenseConcurrency = constrain(preferences.getUChar("dispConc", 1), (uint8_t)1, (uint8_t)DISPENSE_MAX_CONCURRENCY);
   KEYPAD_INPUT_TIMEOUT = preferences.getULong("keypadTime", 3000);
   SLOT_SELECTION_TIMEOUT = preferences.getULong("slotSelTime", 10000);
   DISPLAY_TIMEOUT = preferences.getULong("dispTimeout", 20000);
@@ -531,24 +1481,31 @@ void setup() {
   telegramNotifyAlmostEmpty = preferences.getBool("tgNotifyAlmost", true);
   telegramNotifyEmpty = preferences.getBool("tgNotifyEmpty", true);
   almostEmptyThreshold = preferences.getInt("tgAlmostThres", 5);
-  bot.updateToken(telegramBotToken);
 
   // Display-Texte laden
   displaySlogan = preferences.getString("dispSlogan", "");
   displayFooter = preferences.getString("dispFooter", "www.hanimat.at");
 
-  activeSlots = preferences.getInt("activeSlots", DEFAULT_MAX_SLOTS);
-  if (activeSlots <= 0 || activeSlots > MAX_SLOTS) activeSlots = DEFAULT_MAX_SLOTS;
-
-  for (int i = 0; i < MAX_SLOTS; i++) {
-    slotPrices[i]    = preferences.getFloat(("price" + String(i)).c_str(), 5.0f + (i * 0.1f));
-    slotAvailable[i] = preferences.getBool(("avail" + String(i)).c_str(), true);
-    slotLocked[i]    = preferences.getBool(("locked" + String(i)).c_str(), false);
-  }
+  loadSlotTable();
+  loadPulseTables();
+  loadDoorSensors();
   credit = preferences.getFloat("credit", 0.0f);
+  committedJournalSequence = preferences.getUInt("credSeq", 0);
   savedPassword = preferences.getString("password", DEFAULT_PASSWORD);
+  logRuntimeLevel = min((int)preferences.getUChar("logLevel", LOG_LEVEL_INFO), LOG_COMPILE_LEVEL);
+  ccTalkCoin.enableMask = preferences.getUShort("ccCoinMask", 0xFFFF);
+  ccTalkBill.enableMask = preferences.getUShort("ccBillMask", 0xFFFF);
+  cashlessEnabled = preferences.getBool("ecEnabled", false);
+  preferences.getString("ecHost", cashlessHost, sizeof(cashlessHost));
+  cashlessPort = preferences.getUShort("ecPort", CASHLESS_DEFAULT_PORT);
   preferences.end();
-  logMessage("Settings loaded.");
+  LOG_INFO("Settings loaded.");
+  if (activeSlots > relaySlotCount()) {
+    LOG_WARN("%d slots active, but relays found for %d only.", activeSlots, relaySlotCount());
+  }
+  applyDoorSensors();
+  initMoneyJournal(); // Replays credit changes that were not yet committed
+  initSalesLedger();
 
   // --- Initialize TFT Display ---
   tft.begin();
@@ -577,9 +1534,9 @@ void setup() {
   wm.setConfigPortalTimeout(180);
 
   if (offlineMode) {
-    logMessage("Operating Mode: OFFLINE (GPIO " + String(OFFLINE_MODE_PIN) + " is LOW)");
+    LOG_INFO("Operating Mode: OFFLINE (GPIO %d is LOW)", OFFLINE_MODE_PIN);
     WiFi.softAP("HANIMAT-Offline", "Honig1234");
-    logMessage("Offline AP started. SSID: HANIMAT-Offline, IP: " + WiFi.softAPIP().toString());
+    LOG_INFO("Offline AP started. SSID: HANIMAT-Offline, IP: %s", WiFi.softAPIP().toString().c_str());
     tft.fillScreen(ILI9341_BLACK);
     tft.setFont(&Poppins_Regular10pt7b);
     tft.setTextColor(ILI9341_ORANGE);
@@ -591,7 +1548,7 @@ void setup() {
     delay(5000);
 
   } else {
-    logMessage("Operating Mode: ONLINE (GPIO " + String(OFFLINE_MODE_PIN) + " is HIGH)");
+    LOG_INFO("Operating Mode: ONLINE (GPIO %d is HIGH)", OFFLINE_MODE_PIN);
     preferences.begin("hanimat", false);
     if (preferences.isKey("static_ip")) {
         IPAddress staticIP, gateway, subnet, dns1, dns2;
@@ -601,14 +1558,14 @@ void setup() {
         dns1.fromString(preferences.getString("dns1", "8.8.8.8"));
         dns2.fromString(preferences.getString("dns2", "8.8.4.4"));
         if(staticIP[0] != 0) {
-            logMessage("Attempting to connect with static IP: " + staticIP.toString());
+            LOG_INFO("Attempting to connect with static IP: %s", staticIP.toString().c_str());
             wm.setSTAStaticIPConfig(staticIP, gateway, subnet, dns1);
         }
     }
     preferences.end();
 
     if (!wm.autoConnect("HANIMAT-Setup", "Honig1234")) {
-      logMessage("WiFi connection failed. Starting Config Portal: HANIMAT-Setup");
+      LOG_INFO("WiFi connection failed. Starting Config Portal: HANIMAT-Setup");
       tft.fillScreen(ILI9341_BLACK);
       tft.setFont(&Poppins_Black14pt7b);
       tft.setTextColor(ILI9341_RED);
@@ -640,7 +1597,8 @@ void setup() {
       tft.setCursor((tft.width() - w) / 2, 130);
       tft.println(line4);
     } else {
-      logMessage("WiFi connected! IP: " + WiFi.localIP().toString());
+      LOG_INFO("WiFi connected! IP: %s", WiFi.localIP().toString().c_str());
+      configTime(0, 0, "pool.ntp.org", "time.nist.gov"); // UTC timestamps for the sales ledger
       tft.fillScreen(ILI9341_BLACK);
 
       tft.setFont(&Poppins_Black14pt7b);
@@ -669,917 +1627,3993 @@ void setup() {
   // --- Initialize Web Server ---
   setupWebServer();
 
+  // --- Start Telegram Worker ---
+  telegramConfigMutex = xSemaphoreCreateMutex();
+  telegramQueue = xQueueCreate(TELEGRAM_QUEUE_LENGTH, sizeof(TelegramOutboundMessage));
+  if (telegramQueue == nullptr || telegramConfigMutex == nullptr ||
+      xTaskCreatePinnedToCore(telegramWorkerTask, "telegram", TELEGRAM_TASK_STACK_SIZE, nullptr, 1, &telegramTaskHandle, TELEGRAM_TASK_CORE) != pdPASS) {
+    LOG_ERROR("Could not start Telegram worker task.");
+  } else {
+    LOG_INFO("Telegram worker started on core %d.", TELEGRAM_TASK_CORE);
+  }
+
   // --- Initialize Payment Acceptors ---
+#if PAYMENT_CCTALK
+  initCcTalk();
+#else
   pinMode(COIN_ACCEPTOR_PIN, INPUT);
-  attachInterrupt(digitalPinToInterrupt(COIN_ACCEPTOR_PIN), coinAcceptorISR, RISING);
-  
   pinMode(BILL_ACCEPTOR_PIN, INPUT_PULLUP);
-  attachInterrupt(digitalPinToInterrupt(BILL_ACCEPTOR_PIN), billAcceptorISR, RISING);
+  initPulseCounters();
+#endif
+  initCashless();
 
   // --- Finalize Setup ---
-  logMessage("Setup complete. System is ready.");
   digitalWrite(BILL_INHIBIT_PIN, LOW); // Enable bill acceptor
   displayNeedsUpdate = true;
   lastUserInteractionTime = millis();
   currentSystemState = CurrentSystemState::IDLE;
+
+  // --- Start Display, Vending & Network Tasks ---
+  vendingCommandQueue = xQueueCreate(VENDING_COMMAND_QUEUE_LENGTH, sizeof(VendingCommand));
+  tftMessageQueue = xQueueCreate(1, sizeof(TftMessage));
+  displayFrameQueue = xQueueCreate(DISPLAY_FRAME_QUEUE_LENGTH, sizeof(DisplayFrame));
+  stripCanvas = new GFXcanvas16(tft.width(), DISPLAY_STRIP_HEIGHT);
+  publishVendingSnapshot();
+  if (vendingCommandQueue == nullptr || tftMessageQueue == nullptr || displayFrameQueue == nullptr ||
+      stripCanvas == nullptr || stripCanvas->getBuffer() == nullptr) {
+    LOG_ERROR("Could not create inter-task queues or display buffer. Restarting...");
+    delay(1000);
+    ESP.restart();
+  }
+  // From here on only displayTask() touches the TFT
+  xTaskCreatePinnedToCore(displayTask, "display", DISPLAY_TASK_STACK_SIZE, nullptr, DISPLAY_TASK_PRIORITY, &displayTaskHandle, DISPLAY_TASK_CORE);
+  xTaskCreatePinnedToCore(vendingTask, "vending", VENDING_TASK_STACK_SIZE, nullptr, VENDING_TASK_PRIORITY, &vendingTaskHandle, VENDING_TASK_CORE);
+  xTaskCreatePinnedToCore(networkTask, "network", NETWORK_TASK_STACK_SIZE, nullptr, NETWORK_TASK_PRIORITY, &networkTaskHandle, NETWORK_TASK_CORE);
+  LOG_INFO("Setup complete. System is ready.");
 }
 
 // =================================================================
 //                            MAIN LOOP
 // =================================================================
 void loop() {
-  // Always handle web server clients
-  server.handleClient();
-
-  // Check for factory reset button press (hold for 7 seconds)
-  if (digitalRead(WIFI_RESET_BUTTON) == LOW) {
-    unsigned long pressStart = millis();
-    while (digitalRead(WIFI_RESET_BUTTON) == LOW) {
-      if (millis() - pressStart >= 7000) break;
-      delay(10);
-    }
-    if (millis() - pressStart >= 7000) {
-      logMessage("FACTORY RESET initiated...");
-      tft.fillScreen(ILI9341_BLACK);
-      tft.setTextColor(ILI9341_RED); tft.setTextSize(3);
-      tft.setCursor(10, 80); tft.println("WERKSRESET");
-      tft.setTextSize(2); tft.setCursor(10, 130); tft.println("Daten werden geloescht...");
-      delay(3000);
-
-      // Clear all saved settings
-      preferences.begin("hanimat", true); preferences.clear(); preferences.end();
-      WiFiManager wm; wm.resetSettings();
-      
-      logMessage("Factory reset complete. Restarting...");
-      ESP.restart();
-    }
-  }
+  // All work is done by vendingTask() and networkTask().
+  vTaskDelete(NULL);
+}
 
-  // --- Main state machine ---
-  if (currentSystemState != CurrentSystemState::OTA_UPDATE) {
-    // Timeout for user inactivity, resetting the screen to default
-    if (millis() - lastUserInteractionTime > DISPLAY_TIMEOUT) {
-      if (currentSystemState != CurrentSystemState::IDLE) {
-        logMessage("Display timeout. Reverting to idle screen.");
+/**
+ * @brief Customer-facing state machine: keypad, payment, dispensing and TFT.
+ *        Pinned to VENDING_TASK_CORE; talks to the network side only through
+ *        vendingCommandQueue, tftMessageQueue and the published snapshot.
+ *        Sleeps until an ISR, an esp_timer deadline or a web command wakes it.
+ */
+void vendingTask(void* parameter) {
+  uint32_t events = 0;
+  for (;;) {
+    if (events & VENDING_EVENT_RESET_BUTTON) resetButtonHeld = true;
+    if (resetButtonHeld) checkFactoryResetButton();
+    if ((events & VENDING_EVENT_KEYPAD_WAKE) && !keypadScanning) startKeypadScanning();
+
+    processTftMessages();
+
+    // --- Main state machine ---
+    if (currentSystemState != CurrentSystemState::OTA_UPDATE) {
+      // End of an error message: back to the default screen (a key press ends it earlier)
+      if (currentSystemState == CurrentSystemState::ERROR_DISPLAY && (long)(millis() - errorDisplayUntil) >= 0) {
         resetDisplayToDefault();
       }
-    }
-    
-    // Timeout for slot selection
-    if (selectedSlot != -1 && (millis() - slotSelectedTime > SLOT_SELECTION_TIMEOUT)) {
-        logMessage("Slot selection timed out. Resetting selection.");
-        resetDisplayToDefault();
-    }
-
-    // Process all inputs and jobs
-    processKeypad();
-    processAcceptedCoin();
-    processBillAcceptorPulses();
-    processDispenseJob();
-  }
 
-  // Auto-logout from web interface after timeout
-  if (isAuthenticated && (millis() - lastActivityTimeWeb > WEB_TIMEOUT)) {
-    isAuthenticated = false;
-    logMessage("Web interface auto-logout due to inactivity.");
-  }
-
-  // Update display only when needed
-  if (displayNeedsUpdate && currentSystemState != CurrentSystemState::OTA_UPDATE) {
-    updateDisplayScreen();
-    displayNeedsUpdate = false;
-  }
-
-  // Periodically check WiFi connection and attempt to reconnect if lost
-  static unsigned long lastWiFiCheckTime = 0;
-  bool offlineMode = (digitalRead(OFFLINE_MODE_PIN) == LOW);
-  if (!offlineMode && (millis() - lastWiFiCheckTime > 30000)) {
-      lastWiFiCheckTime = millis();
-      if (WiFi.status() != WL_CONNECTED) {
-          logMessage("WiFi connection lost. Attempting to reconnect...");
-          WiFi.reconnect();
+      // Timeout for user inactivity, resetting the screen to default (a card payment has its own)
+      if (cashlessSession.state == CashlessState::IDLE && millis() - lastUserInteractionTime > DISPLAY_TIMEOUT) {
+        if (currentSystemState != CurrentSystemState::IDLE && currentSystemState != CurrentSystemState::ERROR_DISPLAY) {
+          LOG_INFO("Display timeout. Reverting to idle screen.");
+          resetDisplayToDefault();
+        }
       }
-  }
-  delay(10); // Small delay to prevent watchdog timer issues
-}
-
-// =================================================================
-//                      CORE LOGIC IMPLEMENTATION
-// =================================================================
-
-char manualGetKeyState() {
-  char currentPhysicalKey = 0;
 
-  // Iterate through rows
-  for (int r = 0; r < KEYPAD_ROWS; r++) {
-    digitalWrite(rowPins[r], HIGH); // Activate one row
-    // Check all columns in that row
-    for (int c = 0; c < KEYPAD_COLS; c++) {
-      if (digitalRead(colPins[c]) == HIGH) {
-        currentPhysicalKey = keys[r][c];
-        break;
+      // Learn mode left running
+      if (pulseLearn.active && millis() - pulseLearn.lastActivity >= LEARN_MODE_TIMEOUT_MS) {
+        LOG_WARN("Learn: No insert for %lu min.", LEARN_MODE_TIMEOUT_MS / 60000);
+        stopPulseLearn();
       }
-    }
-    digitalWrite(rowPins[r], LOW); // Deactivate the row
-    if (currentPhysicalKey != 0) {
-      break;
-    }
-  }
 
-  unsigned long now = millis();
+      // Timeout for slot selection
+      if (selectedSlot != -1 && cashlessSession.state == CashlessState::IDLE && (millis() - slotSelectedTime > SLOT_SELECTION_TIMEOUT)) {
+          LOG_INFO("Slot selection timed out. Resetting selection.");
+          resetDisplayToDefault();
+      }
 
-  // Debounce logic
-  if (currentPhysicalKey != lastPhysicallyPressedKey) {
-    lastKeyPressTime = now;
-    lastPhysicallyPressedKey = currentPhysicalKey;
-    if (currentPhysicalKey == 0) {
-        lastReturnedKey = 0; // Reset returned key when released
+      // Process all inputs and jobs
+      processVendingCommands();
+      processKeypad();
+      processAcceptedCoin();
+      processBillAcceptorPulses();
+      processCreditEvents();
+      processCashlessSession();
+      processRelayResults();
+      processDispenseJobs();
+      processRelayTestJob();
     }
-    return 0; // Return nothing on initial press/release
-  }
+    processSettingsCache();
 
-  // If key is held down longer than the debounce period, return it once
-  if (currentPhysicalKey != 0 && (now - lastKeyPressTime > KEYPAD_DEBOUNCE_PERIOD)) {
-    if (currentPhysicalKey != lastReturnedKey) {
-      lastReturnedKey = currentPhysicalKey;
-      return currentPhysicalKey;
+    // Update display only when needed (not over an OTA or error message)
+    if (displayNeedsUpdate && currentSystemState != CurrentSystemState::OTA_UPDATE &&
+        currentSystemState != CurrentSystemState::ERROR_DISPLAY) {
+      updateDisplayScreen();
+      displayNeedsUpdate = false;
     }
+
+    publishVendingSnapshot();
+
+    // Sleep until the next event or the nearest pending timeout
+    armVendingDeadlineTimer();
+    events = 0;
+    xTaskNotifyWait(0, UINT32_MAX, &events, portMAX_DELAY);
   }
-  
-  return 0; // No valid key press
 }
 
 /**
- * @brief Sets up all web server endpoints (routes).
+ * @brief Sets event bits on the vending task from task or timer context.
  */
-void setupWebServer() {
-  server.on("/", HTTP_GET, handleRoot);
-  server.on("/login", HTTP_POST, handleLogin);
-  server.on("/changepassword", HTTP_POST, handleChangePasswordWeb);
-  server.on("/updateprice", HTTP_POST, handleUpdatePriceWeb);
-  server.on("/refill", HTTP_POST, handleRefillWeb);
-  server.on("/addcredit", HTTP_POST, handleAddCreditWeb);
-  server.on("/resetcredit", HTTP_POST, handleResetCreditWeb);
-  server.on("/refillall", HTTP_POST, handleRefillAllWeb);
-  server.on("/triggerrelay", HTTP_POST, handleTriggerRelayWeb);
-  server.on("/triggerallrelays", HTTP_POST, handleTriggerAllRelaysWeb);
-  server.on("/setstaticip", HTTP_POST, handleSetStaticIPWeb);
-  server.on("/updateslots", HTTP_POST, handleUpdateSlotsWeb);
-  server.on("/toggleslotlock", HTTP_POST, handleToggleSlotLockWeb);
-  server.on("/logdata", HTTP_GET, handleLogDataRequest);
-  server.on("/otaupdate", HTTP_GET, handleOTAUpdatePage);
-  server.on("/timingconfig", HTTP_GET, handleTimingConfigPage);
-  server.on("/savetimingconfig", HTTP_POST, handleSaveTimingConfig);
-  server.on("/telegramconfig", HTTP_GET, handleTelegramConfigPage);
-  server.on("/savetelegramconfig", HTTP_POST, handleSaveTelegramConfig);
-  server.on("/sendtesttelegram", HTTP_POST, handleSendTestTelegram);
-  server.on("/displayconfig", HTTP_GET, handleDisplayConfigPage);
-  server.on("/savedisplayconfig", HTTP_POST, handleSaveDisplayConfig);
-   
-  // OTA Upload Handler
-  server.on("/ota-upload", HTTP_POST, []() {
-    otaStatusMessage = "Upload successful. Starting update...";
-    server.sendHeader("Location", "/otaupdate", true);
-    server.send(302, "text/plain", "");
-  }, handleOTAFileUpload);
+void notifyVendingTask(uint32_t events) {
+  if (vendingTaskHandle != nullptr) xTaskNotify(vendingTaskHandle, events, eSetBits);
+}
 
-  // 404 Not Found Handler
-  server.onNotFound([]() {
-    server.send(404, "text/plain", "Page not found.");
-    logMessage("HTTP 404: " + server.uri());
-  });
+void keypadScanTimerCallback(void* arg) { notifyVendingTask(VENDING_EVENT_KEYPAD_SCAN); }
+void vendingDeadlineTimerCallback(void* arg) { notifyVendingTask(VENDING_EVENT_DEADLINE); }
 
-  server.begin();
-  logMessage("Web server started.");
+/**
+ * @brief Configures one PCNT unit to count rising edges on a pin, behind the glitch filter.
+ */
+void configurePulseCounter(pcnt_unit_t unit, int pin) {
+  pcnt_config_t config = {};
+  config.pulse_gpio_num = pin;
+  config.ctrl_gpio_num = PCNT_PIN_NOT_USED;
+  config.lctrl_mode = PCNT_MODE_KEEP;
+  config.hctrl_mode = PCNT_MODE_KEEP;
+  config.pos_mode = PCNT_COUNT_INC;
+  config.neg_mode = PCNT_COUNT_DIS;
+  config.counter_h_lim = PCNT_COUNTER_LIMIT;
+  config.counter_l_lim = -1;
+  config.unit = unit;
+  config.channel = PCNT_CHANNEL_0;
+  pcnt_unit_config(&config);
+  pcnt_set_filter_value(unit, PCNT_GLITCH_FILTER_TICKS);
+  pcnt_filter_enable(unit);
+  pcnt_counter_pause(unit);
+  pcnt_counter_clear(unit);
+  pcnt_counter_resume(unit);
 }
 
 /**
- * @brief Resets the system state and display to the default idle screen.
+ * @brief Starts hardware pulse counting for the coin and bill acceptors. The poll timer that
+ *        turns counts into pulse groups is started by the edge ISRs and stops itself when idle;
+ *        it runs once here for pulses counted before the ISRs were attached.
  */
-void resetDisplayToDefault() {
-  selectedSlot = -1;
-  keypadInputBuffer = "";
-  currentSystemState = CurrentSystemState::IDLE; 
-  displayNeedsUpdate = true;
-  lastUserInteractionTime = millis();
+void initPulseCounters() {
+  coinGroupQueue = xQueueCreate(PULSE_GROUP_QUEUE_LENGTH, sizeof(PulseGroupEvent));
+  billGroupQueue = xQueueCreate(PULSE_GROUP_QUEUE_LENGTH, sizeof(PulseGroupEvent));
+  configurePulseCounter(COIN_PCNT_UNIT, COIN_ACCEPTOR_PIN);
+  configurePulseCounter(BILL_PCNT_UNIT, BILL_ACCEPTOR_PIN);
+
+  esp_timer_create_args_t pollTimerArgs = {};
+  pollTimerArgs.callback = &pulsePollTimerCallback;
+  pollTimerArgs.name = "pulses";
+  if (coinGroupQueue == nullptr || billGroupQueue == nullptr ||
+      esp_timer_create(&pollTimerArgs, &pulsePollTimer) != ESP_OK) {
+    LOG_ERROR("Could not start pulse counting. Coins and bills will not be accepted.");
+    return;
+  }
+  startPulsePolling();
+  attachInterrupt(digitalPinToInterrupt(COIN_ACCEPTOR_PIN), coinAcceptorISR, RISING);
+  attachInterrupt(digitalPinToInterrupt(BILL_ACCEPTOR_PIN), billAcceptorISR, CHANGE);
+  LOG_INFO("Pulse counters started (PCNT units %d/%d).", (int)COIN_PCNT_UNIT, (int)BILL_PCNT_UNIT);
 }
 
 /**
- * @brief Updates the TFT display based on the current system state.
+ * @brief Quiet time after the newest edge that closes the open group: PULSE_GAP_INTERVALS times
+ *        the interval measured in this group (or learned from earlier ones), capped by timeoutMs.
  */
-void updateDisplayScreen() {
-  tft.fillScreen(ILI9341_BLACK);
-  char buffer[50]; // Buffer for formatting strings
-  int16_t x1, y1; uint16_t w, h;
-
-  // --- Static Header ---
-  tft.setFont(&Poppins_Black14pt7b);
-  tft.setTextColor(ILI9341_YELLOW);
-  tft.getTextBounds("HONIGAUTOMAT", 0, 0, &x1, &y1, &w, &h);
-  tft.setCursor((tft.width() - w) / 2, 40);
-  tft.println("HONIGAUTOMAT");
+uint32_t pulseGroupGapUs(const PulseGroupCounter& counter, unsigned long timeoutMs) {
+  uint32_t timeoutUs = timeoutMs * 1000UL;
+  uint32_t interval = counter.maxIntervalUs > 0 ? counter.maxIntervalUs : counter.learnedIntervalUs;
+  if (interval == 0) return timeoutUs; // Nothing measured yet
+  uint32_t gapUs = max<uint32_t>(interval * PULSE_GAP_INTERVALS, PULSE_GAP_MIN_MS * 1000UL);
+  return min(gapUs, timeoutUs);
+}
 
-  // --- Credit Display ---
-  tft.setFont(&Poppins_Regular10pt7b);
-  tft.setTextColor(ILI9341_GREEN);
-  sprintf(buffer, "Guthaben: %.2f EUR", credit);
-  tft.getTextBounds(buffer, 0, 0, &x1, &y1, &w, &h);
-  tft.setCursor(10, 80);
-  tft.println(buffer);
+/**
+ * @brief Ends the open group without crediting it. Returns its pulses.
+ */
+int discardPulseGroup(PulseGroupCounter& counter) {
+  int pulses = (counter.validateEdges && !counter.stampsLost) ? counter.stamped : counter.counted;
+  counter.counted = 0;
+  counter.stamped = 0;
+  counter.stampsLost = false;
+  counter.maxIntervalUs = 0;
+  return pulses;
+}
 
-  // --- WiFi Status Indicator ---
-  bool offlineModeActive = (digitalRead(OFFLINE_MODE_PIN) == LOW);
-  if (!offlineModeActive) {
-    int wifiX = tft.width() - 20;
-    int wifiY = 20;
-    int wifiRadius = 6;
-    tft.fillCircle(wifiX, wifiY, wifiRadius, (WiFi.status() == WL_CONNECTED) ? ILI9341_GREEN : ILI9341_RED);
-  }
+/**
+ * @brief Adds one time-stamped pulse to the open group and tracks the longest interval.
+ */
+void addStampedPulse(PulseGroupCounter& counter, uint32_t startUs) {
+  if (counter.stamped > 0) counter.maxIntervalUs = max(counter.maxIntervalUs, startUs - counter.lastStartUs);
+  counter.lastStartUs = startUs;
+  counter.stamped++;
+}
+
+/**
+ * @brief Checks a complete LOW pulse of an edge-validated input by width and by the period
+ *        to the previous pulse. Spikes and ringing from relay switching fail one of both.
+ */
+void commitValidatedPulse(PulseGroupCounter& counter, uint32_t fallUs, uint32_t riseUs) {
+  uint32_t width = riseUs - fallUs;
+  bool periodOk = counter.stamped == 0 || fallUs - counter.lastStartUs >= BILL_PULSE_MIN_PERIOD_US;
+  if (width < BILL_PULSE_MIN_WIDTH_US || width > BILL_PULSE_MAX_WIDTH_US || !periodOk) {
+    counter.rejected++;
+    return;
+  }
+  addStampedPulse(counter, fallUs);
+}
+
+/**
+ * @brief Feeds one stamped edge (bit 0 = new level) into the edge decoder. A rising edge is
+ *        only taken as the end of a pulse once the line stayed HIGH for BILL_EDGE_GLITCH_US.
+ */
+void decodePulseEdge(PulseGroupCounter& counter, uint32_t stamp) {
+  if ((stamp & 1) == 0) { // Falling: line goes active
+    if (counter.riseTentative) {
+      counter.riseTentative = false;
+      if (stamp - counter.riseUs < BILL_EDGE_GLITCH_US) { counter.lineLow = true; return; } // Spike inside the pulse
+      commitValidatedPulse(counter, counter.fallUs, counter.riseUs);
+    }
+    counter.lineLow = true;
+    counter.fallUs = stamp;
+  } else if (counter.lineLow) { // Rising: end of the active phase
+    counter.lineLow = false;
+    counter.riseTentative = true;
+    counter.riseUs = stamp;
+  }
+}
+
+/**
+ * @brief Drains the edge stamps and the PCNT count into the open group. Returns the pulse count
+ *        once the group has been quiet for pulseGroupGapUs(), otherwise 0. intervalUs receives
+ *        the longest inter-pulse interval of a closed group.
+ */
+int pollPulseGroup(PulseGroupCounter& counter, unsigned long timeoutMs, uint32_t nowUs, uint32_t& intervalUs) {
+  // Timing: edges stamped by the ISR
+  PulseRing& ring = *counter.ring;
+  uint32_t tail = ring.tail.load(std::memory_order_relaxed);
+  uint32_t head = ring.head.load(std::memory_order_acquire);
+  bool edgesSeen = tail != head;
+  for (; tail != head; tail++) {
+    uint32_t stamp = ring.stamps[tail % PULSE_RING_SIZE];
+    if (counter.validateEdges) decodePulseEdge(counter, stamp);
+    else addStampedPulse(counter, stamp);
+    counter.lastEdgeUs = stamp;
+  }
+  ring.tail.store(tail, std::memory_order_release);
+  if (counter.riseTentative && nowUs - counter.riseUs >= BILL_EDGE_GLITCH_US) {
+    counter.riseTentative = false;
+    commitValidatedPulse(counter, counter.fallUs, counter.riseUs);
+  }
+  if (counter.lineLow && nowUs - counter.fallUs > BILL_PULSE_MAX_WIDTH_US) {
+    counter.lineLow = false; // Stuck active or missed the rising edge
+    counter.rejected++;
+  }
+  uint32_t dropped = ring.dropped.load(std::memory_order_relaxed);
+  if (dropped != counter.lastDropped) {
+    counter.lastDropped = dropped;
+    counter.stampsLost = true;
+  }
+
+  // Count: the glitch-filtered PCNT
+  int16_t count = 0;
+  pcnt_get_counter_value(counter.unit, &count);
+  int delta = count - counter.lastCount;
+  if (delta < 0) delta += PCNT_COUNTER_LIMIT; // Wrapped at the high limit
+  counter.lastCount = count;
+  if (delta > 0) {
+    if (!edgesSeen) counter.lastEdgeUs = nowUs; // Edge stamps missed
+    counter.counted += delta;
+  }
+
+  if (counter.counted == 0 && counter.stamped == 0) return 0;
+  if (counter.lineLow || counter.riseTentative) return 0; // Pulse in progress
+  if (nowUs - counter.lastEdgeUs <= pulseGroupGapUs(counter, timeoutMs)) return 0;
+
+  if (counter.validateEdges && counter.stampsLost) { // Not every edge was validated
+    counter.lostGroups++;
+    discardPulseGroup(counter);
+    return 0;
+  }
+
+  // Group closed: learn the interval for the first pulses of the next group
+  intervalUs = counter.maxIntervalUs;
+  if (counter.stamped >= 2) {
+    counter.learnedIntervalUs = counter.learnedIntervalUs == 0
+        ? counter.maxIntervalUs : (counter.learnedIntervalUs * 3 + counter.maxIntervalUs) / 4;
+  }
+  return discardPulseGroup(counter); // Only glitches or rejected pulses: returns 0
+}
+
+/**
+ * @brief True while a counter has an open group or a pulse in progress.
+ */
+bool pulseGroupPending(const PulseGroupCounter& counter) {
+  return counter.counted > 0 || counter.stamped > 0 || counter.lineLow || counter.riseTentative;
+}
+
+/**
+ * @brief Runs every PULSE_POLL_INTERVAL_MS in the esp_timer task while a group is open. Hands
+ *        closed coin and bill groups to the vending task, keeps billGroupOpen up to date and
+ *        stops the timer once both acceptors are idle.
+ */
+void pulsePollTimerCallback(void* arg) {
+  unsigned long now = millis();
+  uint32_t nowUs = (uint32_t)esp_timer_get_time();
+  uint32_t events = 0;
+  PulseGroupEvent group = { 0, 0 };
+
+  group.pulses = pollPulseGroup(coinPulseCounter, COIN_PROCESSING_DELAY, nowUs, group.maxIntervalUs);
+  if (group.pulses > 0) {
+    xQueueSend(coinGroupQueue, &group, 0);
+    events |= VENDING_EVENT_COIN_PULSE;
+  }
+
+  int billPulses = pollPulseGroup(billPulseCounter, BILL_GROUP_PROCESSING_TIMEOUT_MS, nowUs, group.maxIntervalUs);
+  if (now < STARTUP_IGNORE_BILL_TIME) { // Ignore pulses at startup
+    uint32_t ignored = billPulses + discardPulseGroup(billPulseCounter);
+    if (ignored > 0) {
+      billPulsesDiscarded += ignored;
+      billPulses = 0;
+      events |= VENDING_EVENT_BILL_PULSE;
+    }
+  }
+  if (billPulseCounter.rejected > 0) {
+    billPulsesRejected += billPulseCounter.rejected;
+    billPulseCounter.rejected = 0;
+    events |= VENDING_EVENT_BILL_PULSE;
+  }
+  if (billPulseCounter.lostGroups > 0) {
+    billGroupsLost += billPulseCounter.lostGroups;
+    billPulseCounter.lostGroups = 0;
+    events |= VENDING_EVENT_BILL_PULSE;
+  }
+  if (billPulses > 0) {
+    group.pulses = billPulses;
+    xQueueSend(billGroupQueue, &group, 0);
+    events |= VENDING_EVENT_BILL_PULSE;
+  }
+  bool open = billPulseCounter.counted > 0 || billPulseCounter.stamped > 0 || billPulseCounter.lineLow;
+  if (billGroupOpen.exchange(open) != open) events |= VENDING_EVENT_BILL_PULSE;
+
+  if (events != 0) notifyVendingTask(events);
+
+  if (pulseGroupPending(coinPulseCounter) || pulseGroupPending(billPulseCounter)) return;
+  // Stop first, then clear the flag: an edge after the clear restarts the timer from its ISR,
+  // one in between is still in the ring and restarts it here.
+  esp_timer_stop(pulsePollTimer);
+  pulsePollActive.store(false);
+  if (coinPulseRing.head.load() != coinPulseRing.tail.load() || billPulseRing.head.load() != billPulseRing.tail.load()) {
+    startPulsePolling();
+  }
+}
+
+/**
+ * @brief Leaves keypad idle mode: rows back to LOW for scanning and starts the periodic scan timer.
+ */
+void startKeypadScanning() {
+  for (int i = 0; i < KEYPAD_ROWS; i++) digitalWrite(rowPins[i], LOW);
+  keypadScanning = true;
+  esp_timer_start_periodic(keypadScanTimer, KEYPAD_SCAN_INTERVAL_MS * 1000ULL);
+}
+
+/**
+ * @brief Enters keypad idle mode: stops the scan timer and drives all rows HIGH,
+ *        so any key press raises a column and triggers keypadWakeISR().
+ */
+void stopKeypadScanning() {
+  if (keypadScanTimer != nullptr) esp_timer_stop(keypadScanTimer);
+  keypadScanning = false;
+  for (int i = 0; i < KEYPAD_ROWS; i++) digitalWrite(rowPins[i], HIGH);
+}
+
+/**
+ * @brief Arms the deadline timer for the nearest pending timeout of the vending state machine.
+ */
+void armVendingDeadlineTimer() {
+  unsigned long now = millis();
+  long nextDelay = -1; // ms until the nearest deadline, -1 = none
+
+  auto consider = [&](unsigned long deadline) {
+    long remaining = (long)(deadline - now);
+    if (remaining < 0) remaining = 0;
+    if (nextDelay < 0 || remaining < nextDelay) nextDelay = remaining;
+  };
+
+  for (int i = 0; i < dispenseCount; i++) {
+    const DispenseJob& job = dispenseJobAt(i);
+    if (job.stage == DispenseStage::RELAY_PENDING) consider(job.startTime + RELAY_RESULT_TIMEOUT_MS);
+    else if (job.stage == DispenseStage::OPEN) {
+      consider(job.startTime + DISPENSE_RELAY_ON_TIME);
+      if (job.doorSensor != DOOR_SENSOR_NONE) {
+        consider(job.lastDoorPoll + (job.doorReadPending ? DOOR_READ_TIMEOUT_MS : DOOR_POLL_INTERVAL_MS));
+      }
+    }
+  }
+  if (pulseLearn.active) consider(pulseLearn.lastActivity + LEARN_MODE_TIMEOUT_MS);
+  if (relayTestJob.active) consider(relayTestJob.phaseStart + (relayTestJob.relayOn ? relayTestJob.onTime : relayTestJob.offTime));
+  if (currentSystemState == CurrentSystemState::ERROR_DISPLAY) consider(errorDisplayUntil);
+  else if (currentSystemState != CurrentSystemState::IDLE) consider(lastUserInteractionTime + DISPLAY_TIMEOUT + 1);
+  if (selectedSlot != -1) consider(slotSelectedTime + SLOT_SELECTION_TIMEOUT + 1);
+  if (cashlessSession.state != CashlessState::IDLE) consider(cashlessSession.deadline);
+  if (currentSystemState == CurrentSystemState::OTA_UPDATE && !otaUpdateInProgress) consider(lastTftMessageTime + 5001);
+  if (settingsCacheDirty()) consider(settingsCache.lastChangeTime + SETTINGS_COMMIT_QUIET_MS);
+  if (resetButtonHeld) consider(resetButtonPressTime + FACTORY_RESET_HOLD_MS);
+
+  esp_timer_stop(vendingDeadlineTimer);
+  if (nextDelay >= 0) {
+    esp_timer_start_once(vendingDeadlineTimer, nextDelay > 0 ? (uint64_t)nextDelay * 1000ULL : 1);
+  }
+}
+
+/**
+ * @brief Checks for a factory reset (reset button held for FACTORY_RESET_HOLD_MS). Runs while a
+ *        press is being timed; a release ends the hold, a new press restarts it from the ISR.
+ */
+void checkFactoryResetButton() {
+  if (digitalRead(WIFI_RESET_BUTTON) != LOW) {
+    resetButtonHeld = false;
+    return;
+  }
+  if (millis() - resetButtonPressTime >= FACTORY_RESET_HOLD_MS) {
+    LOG_INFO("FACTORY RESET initiated...");
+    static DisplayFrame frame;
+    beginDisplayOverlay(frame);
+    addOverlayItem(frame, &Poppins_Black14pt7b, ILI9341_RED, 10, 80, "WERKSRESET");
+    addOverlayItem(frame, &Poppins_Regular10pt7b, ILI9341_RED, 10, 130, "Daten werden geloescht...");
+    postDisplayFrame(frame);
+    delay(3000);
+
+    // Clear all saved settings
+    preferences.begin("hanimat", false); preferences.clear(); preferences.end();
+    eraseMoneyJournal();
+    WiFiManager wm; wm.resetSettings();
+
+    LOG_INFO("Factory reset complete. Restarting...");
+    ESP.restart();
+  }
+}
+
+/**
+ * @brief Network side: web server, auto-logout and WiFi reconnect.
+ *        Pinned to NETWORK_TASK_CORE so a slow client never delays vending.
+ */
+void networkTask(void* parameter) {
+  unsigned long lastWiFiCheckTime = 0;
+  for (;;) {
+    server.handleClient();
+
+    // Auto-logout from web interface after timeout
+    if (isAuthenticated && (millis() - lastActivityTimeWeb > WEB_TIMEOUT)) {
+      isAuthenticated = false;
+      LOG_INFO("Web interface auto-logout due to inactivity.");
+    }
+
+    // Periodically check WiFi connection and attempt to reconnect if lost
+    bool offlineMode = (digitalRead(OFFLINE_MODE_PIN) == LOW);
+    if (!offlineMode && (millis() - lastWiFiCheckTime > 30000)) {
+        lastWiFiCheckTime = millis();
+        if (WiFi.status() != WL_CONNECTED) {
+            LOG_INFO("WiFi connection lost. Attempting to reconnect...");
+            WiFi.reconnect();
+        }
+    }
+    vTaskDelay(pdMS_TO_TICKS(2));
+  }
+}
+
+// =================================================================
+//                      SETTINGS CACHE & MONEY JOURNAL
+// =================================================================
+
+/**
+ * @brief Marks the credit as changed and appends it to the money journal.
+ */
+void markCreditChanged() {
+  settingsCache.creditDirty = true;
+  settingsCache.lastChangeTime = millis();
+  appendMoneyJournal();
+}
+
+/**
+ * @brief Marks the slot table (prices, availability, locks, active slots) for the next blob commit.
+ */
+void markSlotTableChanged() {
+  settingsCache.slotTableDirty = true;
+  settingsCache.lastChangeTime = millis();
+}
+
+/**
+ * @brief Checks whether the cache holds changes not yet written to NVS.
+ */
+bool settingsCacheDirty() {
+  return settingsCache.creditDirty || settingsCache.slotTableDirty;
+}
+
+/**
+ * @brief Writes all dirty values to NVS in a single Preferences session.
+ */
+void commitSettingsCache() {
+  if (!settingsCacheDirty()) return;
+
+  int keysWritten = 0;
+  preferences.begin("hanimat", false);
+  if (settingsCache.creditDirty) {
+    preferences.putFloat("credit", credit);
+    preferences.putUInt("credSeq", journalSequence);
+    keysWritten += 2;
+  }
+  if (settingsCache.slotTableDirty) {
+    saveSlotTable();
+    keysWritten++;
+  }
+  preferences.end();
+
+  if (settingsCache.creditDirty) committedJournalSequence = journalSequence;
+  settingsCache.creditDirty = false;
+  settingsCache.slotTableDirty = false;
+  LOG_DEBUG("Settings: Committed %d key(s) to NVS.", keysWritten);
+}
+
+/**
+ * @brief Commits the cache once no change happened for SETTINGS_COMMIT_QUIET_MS.
+ */
+void processSettingsCache() {
+  if (settingsCacheDirty() && (millis() - settingsCache.lastChangeTime >= SETTINGS_COMMIT_QUIET_MS)) {
+    commitSettingsCache();
+  }
+}
+
+/**
+ * @brief Reads a slot table blob written with SLOTS slots. Slots beyond SLOTS get the defaults.
+ *        Must be called inside an open Preferences session.
+ * @return False if there is no valid blob of that size.
+ */
+template <int SLOTS>
+bool readSlotTableBlob() {
+  SlotTableLayout<SLOTS>* blob = new SlotTableLayout<SLOTS>();
+  bool valid = preferences.getBytesLength(SLOT_TABLE_KEY) == sizeof(*blob) &&
+               preferences.getBytes(SLOT_TABLE_KEY, blob, sizeof(*blob)) == sizeof(*blob) &&
+               blob->version == SLOT_TABLE_VERSION && blob->slotCount == SLOTS &&
+               blob->crc == crc32_le(0, (const uint8_t*)blob, offsetof(SlotTableLayout<SLOTS>, crc));
+  if (valid) {
+    activeSlots = blob->activeSlots;
+    for (int i = 0; i < MAX_SLOTS; i++) {
+      slotPrices[i]    = i < SLOTS ? blob->prices[i] : 5.0f + (i * 0.1f);
+      slotAvailable[i] = i < SLOTS ? blob->available[i] != 0 : true;
+      slotLocked[i]    = i < SLOTS ? blob->locked[i] != 0 : false;
+    }
+  }
+  delete blob;
+  return valid;
+}
+
+/**
+ * @brief Loads the slot table blob. Falls back to the legacy per-key layout
+ *        (price0.., avail0.., locked0..) and migrates it on first boot.
+ *        Must be called inside an open Preferences session.
+ */
+void loadSlotTable() {
+  if (readSlotTableBlob<MAX_SLOTS>()) {
+    LOG_INFO("Slot table loaded (%d slots).", MAX_SLOTS);
+  } else if (readSlotTableBlob<SLOT_TABLE_LEGACY_SLOTS>()) {
+    saveSlotTable();
+    LOG_INFO("Slot table extended from %d to %d slots.", SLOT_TABLE_LEGACY_SLOTS, MAX_SLOTS);
+  } else {
+    if (preferences.isKey(SLOT_TABLE_KEY)) {
+      LOG_WARN("Slot table invalid (version/CRC). Rebuilding from legacy keys/defaults.");
+    }
+    bool migrated = migrateLegacySlotKeys();
+    saveSlotTable();
+    LOG_INFO("%s", migrated ? "Slot table migrated from legacy keys." : "Slot table initialized with defaults.");
+  }
+  if (activeSlots <= 0 || activeSlots > MAX_SLOTS) activeSlots = DEFAULT_MAX_SLOTS;
+}
+
+/**
+ * @brief Reads the legacy per-key slot layout (or defaults) into RAM and removes the old keys.
+ *        Must be called inside an open Preferences session.
+ * @return True if at least one legacy key was found.
+ */
+bool migrateLegacySlotKeys() {
+  bool found = preferences.isKey("activeSlots");
+  activeSlots = preferences.getInt("activeSlots", DEFAULT_MAX_SLOTS);
+  preferences.remove("activeSlots");
+
+  char key[12];
+  for (int i = 0; i < MAX_SLOTS; i++) {
+    snprintf(key, sizeof(key), "price%d", i);
+    if (preferences.isKey(key)) { found = true; }
+    slotPrices[i] = preferences.getFloat(key, 5.0f + (i * 0.1f));
+    preferences.remove(key);
+
+    snprintf(key, sizeof(key), "avail%d", i);
+    if (preferences.isKey(key)) { found = true; }
+    slotAvailable[i] = preferences.getBool(key, true);
+    preferences.remove(key);
+
+    snprintf(key, sizeof(key), "locked%d", i);
+    if (preferences.isKey(key)) { found = true; }
+    slotLocked[i] = preferences.getBool(key, false);
+    preferences.remove(key);
+  }
+  return found;
+}
+
+/**
+ * @brief Writes the slot table as a single blob (one flash operation).
+ *        Must be called inside an open Preferences session.
+ */
+void saveSlotTable() {
+  static SlotTableBlob blob; // ~800 bytes, kept off the task stacks
+  memset(&blob, 0, sizeof(blob));
+  blob.version = SLOT_TABLE_VERSION;
+  blob.slotCount = MAX_SLOTS;
+  blob.activeSlots = activeSlots;
+  for (int i = 0; i < MAX_SLOTS; i++) {
+    blob.prices[i]    = slotPrices[i];
+    blob.available[i] = slotAvailable[i] ? 1 : 0;
+    blob.locked[i]    = slotLocked[i] ? 1 : 0;
+  }
+  blob.crc = crc32_le(0, (const uint8_t*)&blob, offsetof(SlotTableBlob, crc));
+  if (preferences.putBytes(SLOT_TABLE_KEY, &blob, sizeof(blob)) != sizeof(blob)) {
+    LOG_ERROR("Could not write slot table to NVS.");
+  }
+}
+
+/**
+ * @brief Loads the pulse-to-value tables. Keeps the compiled-in defaults if there is no valid blob.
+ *        Must be called inside an open Preferences session.
+ */
+void loadPulseTables() {
+  PulseTableBlob blob;
+  if (preferences.getBytesLength(PULSE_TABLE_KEY) == sizeof(blob) &&
+      preferences.getBytes(PULSE_TABLE_KEY, &blob, sizeof(blob)) == sizeof(blob) &&
+      blob.version == PULSE_TABLE_VERSION && blob.tableSize == PULSE_TABLE_SIZE &&
+      blob.crc == crc32_le(0, (const uint8_t*)&blob, offsetof(PulseTableBlob, crc))) {
+    memcpy(pulseValues, blob.coinCents, sizeof(pulseValues));
+    memcpy(billValues, blob.billEuros, sizeof(billValues));
+    LOG_INFO("Pulse tables loaded (v%u).", blob.version);
+  } else if (preferences.isKey(PULSE_TABLE_KEY)) {
+    LOG_WARN("Pulse tables invalid (version/CRC). Using defaults.");
+  }
+}
+
+/**
+ * @brief Writes both pulse-to-value tables as a single blob. Opens its own Preferences session.
+ */
+void savePulseTables() {
+  PulseTableBlob blob;
+  memset(&blob, 0, sizeof(blob));
+  blob.version = PULSE_TABLE_VERSION;
+  blob.tableSize = PULSE_TABLE_SIZE;
+  memcpy(blob.coinCents, pulseValues, sizeof(pulseValues));
+  memcpy(blob.billEuros, billValues, sizeof(billValues));
+  blob.crc = crc32_le(0, (const uint8_t*)&blob, offsetof(PulseTableBlob, crc));
+  preferences.begin("hanimat", false);
+  if (preferences.putBytes(PULSE_TABLE_KEY, &blob, sizeof(blob)) != sizeof(blob)) {
+    LOG_ERROR("Could not write pulse tables to NVS.");
+  }
+  preferences.end();
+}
+
+/**
+ * @brief Loads the door sensor assignment. Without a valid blob no slot has a sensor.
+ *        Must be called inside an open Preferences session.
+ */
+void loadDoorSensors() {
+  DoorSensorBlob blob;
+  memset(doorSensors, DOOR_SENSOR_NONE, sizeof(doorSensors));
+  if (preferences.getBytesLength(DOOR_SENSOR_KEY) == sizeof(blob) &&
+      preferences.getBytes(DOOR_SENSOR_KEY, &blob, sizeof(blob)) == sizeof(blob) &&
+      blob.version == DOOR_SENSOR_VERSION &&
+      blob.crc == crc32_le(0, (const uint8_t*)&blob, offsetof(DoorSensorBlob, crc))) {
+    memcpy(doorSensors, blob.sensors, sizeof(doorSensors));
+    doorOpenHigh = blob.openHigh != 0;
+  } else if (preferences.isKey(DOOR_SENSOR_KEY)) {
+    LOG_WARN("Door sensor table in NVS is invalid. No door sensors in use.");
+  }
+}
+
+/**
+ * @brief Stores the door sensor assignment as one blob.
+ */
+void saveDoorSensors() {
+  DoorSensorBlob blob;
+  memset(&blob, 0, sizeof(blob));
+  blob.version = DOOR_SENSOR_VERSION;
+  blob.openHigh = doorOpenHigh ? 1 : 0;
+  memcpy(blob.sensors, doorSensors, sizeof(doorSensors));
+  blob.crc = crc32_le(0, (const uint8_t*)&blob, offsetof(DoorSensorBlob, crc));
+  preferences.begin("hanimat", false);
+  if (preferences.putBytes(DOOR_SENSOR_KEY, &blob, sizeof(blob)) != sizeof(blob)) {
+    LOG_ERROR("Could not write door sensors to NVS.");
+  }
+  preferences.end();
+}
+
+/**
+ * @brief True if a sensor value names a pin that can be read: a GPIO of DOOR_SENSOR_GPIOS or an
+ *        expander pin that is fitted and not the relay output of an active slot.
+ */
+bool doorSensorUsable(uint8_t sensor) {
+  if (sensor == DOOR_SENSOR_NONE) return false;
+  if (sensor & DOOR_SENSOR_GPIO) {
+    for (uint8_t gpio : DOOR_SENSOR_GPIOS) {
+      if (gpio == (sensor & ~DOOR_SENSOR_GPIO)) return true;
+    }
+    return false;
+  }
+  return sensor >= activeSlots && sensor < relaySlotCount();
+}
+
+/**
+ * @brief Configures the pins of all assigned door sensors as inputs. Expander pins are switched
+ *        through the I2C task; pins no longer used as sensors become outputs (off) again.
+ */
+void applyDoorSensors() {
+  doorSensorExpanders = relayExpanderCount;
+  uint16_t inputMasks[RELAY_MAX_EXPANDERS] = {};
+  for (int slot = 0; slot < activeSlots; slot++) {
+    uint8_t sensor = doorSensors[slot];
+    if (sensor == DOOR_SENSOR_NONE) continue;
+    if (!doorSensorUsable(sensor)) {
+      LOG_WARN("Door sensor of slot %d (pin %u) is not usable and ignored.", slot + 1, sensor);
+      continue;
+    }
+    if (sensor & DOOR_SENSOR_GPIO) {
+      pinMode(sensor & ~DOOR_SENSOR_GPIO, INPUT);
+    } else {
+      inputMasks[sensor / RELAYS_PER_EXPANDER] |= 1U << (sensor % RELAYS_PER_EXPANDER);
+    }
+  }
+  if (i2cRequestQueue == nullptr) return;
+  for (int i = 0; i < doorSensorExpanders; i++) {
+    I2cRequest request = { I2cOp::SET_INPUTS, (uint8_t)i, inputMasks[i], 0, nullptr };
+    if (xQueueSend(i2cRequestQueue, &request, pdMS_TO_TICKS(100)) != pdTRUE) {
+      LOG_ERROR("I2C queue full, door sensor pins of expander 0x%02X not configured.", RELAY_I2C_ADDRESS + i);
+    }
+  }
+}
+
+uint32_t journalRecordCrc(const JournalRecord& record) {
+  return crc32_le(0, (const uint8_t*)&record, offsetof(JournalRecord, crc));
+}
+
+/**
+ * @brief Finds the journal partition, locates the write position and replays
+ *        credit changes newer than the last NVS commit.
+ */
+void initMoneyJournal() {
+  journalPartition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, JOURNAL_PARTITION_LABEL);
+  if (journalPartition == nullptr) {
+    LOG_WARN("No '" JOURNAL_PARTITION_LABEL "' partition. Credit is committed to NVS directly.");
+    return;
+  }
+
+  // Find the newest valid record
+  JournalRecord record;
+  JournalRecord newest = {};
+  bool found = false;
+  uint32_t newestOffset = 0;
+  for (uint32_t offset = 0; offset + sizeof(JournalRecord) <= journalPartition->size; offset += sizeof(JournalRecord)) {
+    if (esp_partition_read(journalPartition, offset, &record, sizeof(record)) != ESP_OK) break;
+    if (record.magic != JOURNAL_RECORD_MAGIC || record.crc != journalRecordCrc(record)) continue;
+    if (!found || (int32_t)(record.sequence - newest.sequence) > 0) {
+      newest = record;
+      newestOffset = offset;
+      found = true;
+    }
+  }
+
+  journalSequence = committedJournalSequence;
+  if (found) {
+    journalWriteOffset = (newestOffset + sizeof(JournalRecord)) % journalPartition->size;
+    if ((int32_t)(newest.sequence - committedJournalSequence) > 0) {
+      credit = newest.creditCents / 100.0f;
+      journalSequence = newest.sequence;
+      settingsCache.creditDirty = true; // Write the recovered value back to NVS
+      LOG_WARN("Journal: Recovered uncommitted credit %.2f EUR (seq %u).", credit, (unsigned)newest.sequence);
+      commitSettingsCache();
+    } else {
+      journalSequence = max(journalSequence, newest.sequence);
+    }
+  } else {
+    journalWriteOffset = 0;
+  }
+
+  // Pre-erasing needs a second sector; with one the write sector would be erased
+  if (journalPartition->size >= 2 * SPI_FLASH_SEC_SIZE) {
+    journalEraseMutex = xSemaphoreCreateMutex();
+    if (journalEraseMutex == nullptr ||
+        xTaskCreatePinnedToCore(journalEraseTask, "journal", 2048, nullptr, 1, &journalEraseTaskHandle, NETWORK_TASK_CORE) != pdPASS) {
+      LOG_WARN("Journal: No erase task, sectors are erased on append.");
+      journalEraseTaskHandle = nullptr;
+    } else {
+      // The sector to enter next: the one at the write offset if it starts a sector. Neither
+      // holds the newest record, which lies just before the write offset.
+      uint32_t sectorStart = journalWriteOffset - journalWriteOffset % SPI_FLASH_SEC_SIZE;
+      journalEraseTarget = journalWriteOffset == sectorStart ? sectorStart : (sectorStart + SPI_FLASH_SEC_SIZE) % journalPartition->size;
+      xTaskNotifyGive(journalEraseTaskHandle);
+    }
+  }
+  LOG_INFO("Journal ready at offset %u.", (unsigned)journalWriteOffset);
+}
+
+/**
+ * @brief Erases the sector the journal will enter next, away from the credit path. Holds
+ *        journalEraseMutex while erasing, so appendMoneyJournal() never writes into a sector
+ *        that is still being erased.
+ */
+void journalEraseTask(void* parameter) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    xSemaphoreTake(journalEraseMutex, portMAX_DELAY);
+    uint32_t target = journalEraseTarget;
+    journalEraseTarget = JOURNAL_SECTOR_NONE;
+    if (target != JOURNAL_SECTOR_NONE) {
+      if (esp_partition_erase_range(journalPartition, target, SPI_FLASH_SEC_SIZE) == ESP_OK) {
+        journalErasedSector = target;
+      } else {
+        LOG_ERROR("Journal: Pre-erase of sector at %u failed.", (unsigned)target);
+      }
+    }
+    xSemaphoreGive(journalEraseMutex);
+  }
+}
+
+/**
+ * @brief Makes sure the sector starting at the write offset is erased before the first record
+ *        goes in. Only waits for flash if the erase task has not finished (or does not run).
+ */
+void enterJournalSector() {
+  if (journalEraseTaskHandle == nullptr) {
+    esp_partition_erase_range(journalPartition, journalWriteOffset, SPI_FLASH_SEC_SIZE);
+    return;
+  }
+  xSemaphoreTake(journalEraseMutex, portMAX_DELAY);
+  if (journalErasedSector != journalWriteOffset) {
+    LOG_WARN("Journal: Sector at %u not erased ahead, erasing now.", (unsigned)journalWriteOffset);
+    esp_partition_erase_range(journalPartition, journalWriteOffset, SPI_FLASH_SEC_SIZE);
+  }
+  journalErasedSector = JOURNAL_SECTOR_NONE;
+  xSemaphoreGive(journalEraseMutex);
+}
+
+/**
+ * @brief Queues the erase of the sector after the write offset. Called once the first record
+ *        of the current sector has been written and read back, never earlier: until then the
+ *        sector to be erased may hold the newest valid records.
+ */
+void queueJournalPreErase() {
+  if (journalEraseTaskHandle == nullptr) return;
+  uint32_t sectorStart = journalWriteOffset - journalWriteOffset % SPI_FLASH_SEC_SIZE;
+  xSemaphoreTake(journalEraseMutex, portMAX_DELAY);
+  journalEraseTarget = (sectorStart + SPI_FLASH_SEC_SIZE) % journalPartition->size;
+  xSemaphoreGive(journalEraseMutex);
+  xTaskNotifyGive(journalEraseTaskHandle);
+}
+
+/**
+ * @brief Appends the current credit to the journal. The sector was normally erased ahead by
+ *        journalEraseTask(), so this is a single flash write.
+ */
+void appendMoneyJournal() {
+  if (journalPartition == nullptr) {
+    commitSettingsCache(); // No journal: keep the old behaviour and write through
+    return;
+  }
+
+  bool firstInSector = journalWriteOffset % SPI_FLASH_SEC_SIZE == 0;
+  if (firstInSector) enterJournalSector();
+
+  JournalRecord record = {};
+  record.magic = JOURNAL_RECORD_MAGIC;
+  record.reserved = 0xFFFF;
+  record.sequence = ++journalSequence;
+  record.creditCents = (int32_t)lroundf(credit * 100.0f);
+  record.crc = journalRecordCrc(record);
+
+  JournalRecord readBack;
+  if (esp_partition_write(journalPartition, journalWriteOffset, &record, sizeof(record)) != ESP_OK ||
+      esp_partition_read(journalPartition, journalWriteOffset, &readBack, sizeof(readBack)) != ESP_OK ||
+      memcmp(&readBack, &record, sizeof(record)) != 0) {
+    LOG_ERROR("Journal write failed. Committing credit directly.");
+    commitSettingsCache();
+  } else if (firstInSector) {
+    queueJournalPreErase(); // A newer record is safe now, the previous sector may go
+  }
+  journalWriteOffset = (journalWriteOffset + sizeof(JournalRecord)) % journalPartition->size;
+}
+
+/**
+ * @brief Erases the whole journal (factory reset).
+ */
+void eraseMoneyJournal() {
+  if (journalPartition == nullptr) return;
+  if (journalEraseMutex != nullptr) xSemaphoreTake(journalEraseMutex, portMAX_DELAY);
+  esp_partition_erase_range(journalPartition, 0, journalPartition->size);
+  journalErasedSector = JOURNAL_SECTOR_NONE;
+  journalEraseTarget = JOURNAL_SECTOR_NONE;
+  if (journalEraseMutex != nullptr) xSemaphoreGive(journalEraseMutex);
+  journalWriteOffset = 0;
+  journalSequence = 0;
+}
+
+// =================================================================
+//                      SALES LEDGER
+// =================================================================
+
+/**
+ * @brief Returns the partition offset of a ledger record.
+ */
+uint32_t ledgerOffsetForSequence(uint32_t sequence) {
+  return ((sequence - 1) % ledgerCapacity) * sizeof(LedgerRecord);
+}
+
+/**
+ * @brief Reads and validates one ledger record by its sequence number (O(1)).
+ * @return False if the record was overwritten, never written or is corrupt.
+ */
+bool readLedgerRecord(uint32_t sequence, LedgerRecord& record) {
+  if (ledgerPartition == nullptr || sequence == 0 || sequence > ledgerNewestSequence) return false;
+  if (esp_partition_read(ledgerPartition, ledgerOffsetForSequence(sequence), &record, sizeof(record)) != ESP_OK) return false;
+  return record.magic == LEDGER_RECORD_MAGIC && record.sequence == sequence &&
+         record.crc == crc32_le(0, (const uint8_t*)&record, offsetof(LedgerRecord, crc));
+}
+
+/**
+ * @brief Finds the ledger partition and the newest record, then starts the writer task.
+ *        Reads the first record of every sector plus one sector, not the whole ledger.
+ */
+void initSalesLedger() {
+  ledgerPartition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, LEDGER_PARTITION_LABEL);
+  if (ledgerPartition == nullptr) {
+    LOG_WARN("No '" LEDGER_PARTITION_LABEL "' partition. Sales are not recorded.");
+    return;
+  }
+  ledgerCapacity = ledgerPartition->size / sizeof(LedgerRecord);
+  const uint32_t recordsPerSector = SPI_FLASH_SEC_SIZE / sizeof(LedgerRecord);
+  const uint32_t sectorCount = ledgerPartition->size / SPI_FLASH_SEC_SIZE;
+
+  // The sector whose first record has the highest sequence holds the newest record
+  LedgerRecord record;
+  uint32_t newestSector = 0, sectorHeadSequence = 0;
+  for (uint32_t sector = 0; sector < sectorCount; sector++) {
+    if (esp_partition_read(ledgerPartition, sector * SPI_FLASH_SEC_SIZE, &record, sizeof(record)) != ESP_OK) continue;
+    if (record.magic != LEDGER_RECORD_MAGIC || record.crc != crc32_le(0, (const uint8_t*)&record, offsetof(LedgerRecord, crc))) continue;
+    if (record.sequence > sectorHeadSequence) {
+      sectorHeadSequence = record.sequence;
+      newestSector = sector;
+    }
+  }
+
+  uint32_t newest = 0;
+  for (uint32_t i = 0; sectorHeadSequence > 0 && i < recordsPerSector; i++) {
+    uint32_t offset = newestSector * SPI_FLASH_SEC_SIZE + i * sizeof(LedgerRecord);
+    if (esp_partition_read(ledgerPartition, offset, &record, sizeof(record)) != ESP_OK) break;
+    if (record.magic != LEDGER_RECORD_MAGIC || record.crc != crc32_le(0, (const uint8_t*)&record, offsetof(LedgerRecord, crc))) break;
+    newest = record.sequence;
+  }
+  ledgerNewestSequence = newest;
+
+  ledgerQueue = xQueueCreate(LEDGER_QUEUE_LENGTH, sizeof(LedgerRecord));
+  if (ledgerQueue == nullptr ||
+      xTaskCreatePinnedToCore(ledgerWriterTask, "ledger", 4096, nullptr, 1, &ledgerTaskHandle, NETWORK_TASK_CORE) != pdPASS) {
+    LOG_ERROR("Could not start sales ledger writer.");
+    ledgerPartition = nullptr;
+    return;
+  }
+  LOG_INFO("Sales ledger ready: %u sale(s), capacity %u.", (unsigned)ledgerNewestSequence, (unsigned)ledgerCapacity);
+}
+
+/**
+ * @brief Queues a sale for the ledger (O(1), never waits for flash) and resets the session payment mix.
+ */
+void recordSale(int slot, float price, float creditBefore, float creditAfter, bool cashless, bool doorUnconfirmed) {
+  LedgerRecord record;
+  memset(&record, 0, sizeof(record));
+  record.slot = (uint8_t)slot;
+  if (cashless) record.flags |= LEDGER_FLAG_CASHLESS;
+  if (doorUnconfirmed) record.flags |= LEDGER_FLAG_DOOR_UNCONFIRMED;
+  time_t now = time(nullptr);
+  if (now > 1600000000) { // NTP time is set
+    record.flags |= LEDGER_FLAG_TIME_VALID;
+    record.timestamp = (uint32_t)now;
+  } else {
+    record.timestamp = millis() / 1000;
+  }
+  record.priceCents = (uint16_t)lroundf(price * 100.0f);
+  record.creditBeforeCents = (int32_t)lroundf(creditBefore * 100.0f);
+  record.creditAfterCents = (int32_t)lroundf(creditAfter * 100.0f);
+  record.coinCents = (uint16_t)constrain(sessionCoinCents, (int32_t)0, (int32_t)UINT16_MAX);
+  record.billEuros = (uint16_t)constrain(sessionBillEuros, (int32_t)0, (int32_t)UINT16_MAX);
+  record.manualCents = (int16_t)constrain(sessionManualCents, (int32_t)INT16_MIN, (int32_t)INT16_MAX);
+  sessionCoinCents = 0; sessionBillEuros = 0; sessionManualCents = 0;
+
+  if (ledgerQueue == nullptr) return;
+  if (xQueueSend(ledgerQueue, &record, 0) != pdTRUE) {
+    ledgerDropped++;
+    LOG_ERROR("Sales ledger queue full. Sale not recorded.");
+  }
+}
+
+/**
+ * @brief Background task that appends queued sales to flash. Erases a sector only
+ *        when the ring enters it, so the vending task never waits for an erase.
+ */
+void ledgerWriterTask(void* parameter) {
+  LedgerRecord record;
+  for (;;) {
+    if (xQueueReceive(ledgerQueue, &record, portMAX_DELAY) != pdTRUE) continue;
+
+    uint32_t sequence = ledgerNewestSequence + 1;
+    uint32_t offset = ledgerOffsetForSequence(sequence);
+    if (offset % SPI_FLASH_SEC_SIZE == 0 &&
+        esp_partition_erase_range(ledgerPartition, offset, SPI_FLASH_SEC_SIZE) != ESP_OK) {
+      LOG_ERROR("Sales ledger sector erase failed.");
+      continue;
+    }
+
+    record.magic = LEDGER_RECORD_MAGIC;
+    record.sequence = sequence;
+    record.crc = crc32_le(0, (const uint8_t*)&record, offsetof(LedgerRecord, crc));
+    if (esp_partition_write(ledgerPartition, offset, &record, sizeof(record)) == ESP_OK) {
+      ledgerNewestSequence = sequence;
+    } else {
+      LOG_ERROR("Sales ledger write failed.");
+    }
+  }
+}
+
+// =================================================================
+//                      CCTALK PAYMENT DRIVER
+// =================================================================
+
+/**
+ * @brief Sends the master enable and the enable mask to the device (ccTalk inhibit bits:
+ *        1 = accepted). Both are idempotent, so this also restores them after an unseen reset.
+ */
+bool applyCcTalkEnables(CcTalkDevice& device) {
+  uint16_t mask = device.enableMask;
+  if (ccTalkBus.setMasterEnable(device.address, true) < 0 || ccTalkBus.setInhibits(device.address, mask) < 0) return false;
+  if (mask != device.appliedMask) LOG_INFO("ccTalk: %s enable mask set to 0x%04X.", device.name, mask);
+  device.appliedMask = mask;
+  device.lastApply = millis();
+  return true;
+}
+
+/**
+ * @brief Brings a device online: reads its type table, enables it and syncs the event counter.
+ *        Events buffered before that are not credited (they belong to an earlier session).
+ */
+bool setupCcTalkDevice(CcTalkDevice& device) {
+  bool bill = device.acceptor == PULSE_ACCEPTOR_BILL;
+  uint8_t reply[CCTALK_MAX_DATA];
+  if (ccTalkBus.transact(device.address, CCTALK_HDR_SIMPLE_POLL, nullptr, 0, reply, 0) < 0) return false;
+
+  int known = 0;
+  for (uint8_t type = 1; type <= CCTALK_TYPES; type++) {
+    int length = ccTalkBus.transact(device.address, bill ? CCTALK_HDR_REQUEST_BILL_ID : CCTALK_HDR_REQUEST_COIN_ID,
+                                    &type, 1, reply, sizeof(reply));
+    device.values[type - 1] = length > 0 ? ccTalkBus.typeValue(device.address, bill, reply, length) : 0;
+    if (device.values[type - 1] > 0) known++;
+  }
+
+  if (!applyCcTalkEnables(device)) return false;
+  CcTalkEvents events;
+  if (ccTalkBus.readEvents(device.address, bill, 0, events) < 0) return false;
+  device.eventCounter = events.counter;
+  device.failures = 0;
+  device.online = true;
+  LOG_INFO("ccTalk: %s online (address %u, %d types known, enable mask 0x%04X).", device.name, device.address, known, device.appliedMask);
+  return true;
+}
+
+/**
+ * @brief Handles one buffered event: credits accepted coins/bills, routes bills in escrow and
+ *        counts rejects. type 0 marks a status event whose code says what happened.
+ */
+void handleCcTalkEvent(CcTalkDevice& device, uint8_t type, uint8_t code) {
+  bool bill = device.acceptor == PULSE_ACCEPTOR_BILL;
+  if (type == 0) {
+    if (code != 0) {
+      device.rejected++;
+      LOG_DEBUG("ccTalk: %s reported status/reject code %u.", device.name, code);
+    }
+    return;
+  }
+  uint16_t value = type <= CCTALK_TYPES ? device.values[type - 1] : 0;
+
+  if (bill && code == CCTALK_BILL_ESCROW) {
+    // Held in escrow: stack it only if we know and accept its value, otherwise hand it back
+    bool accept = value > 0 && (device.appliedMask & (1U << (type - 1)));
+    uint8_t route = accept ? CCTALK_ROUTE_STACK : CCTALK_ROUTE_RETURN;
+    if (ccTalkBus.transact(device.address, CCTALK_HDR_ROUTE_BILL, &route, 1, nullptr, 0) < 0) {
+      LOG_WARN("ccTalk: Could not route bill type %u (validator returns it on timeout).", type);
+    } else {
+      LOG_DEBUG("ccTalk: Bill type %u in escrow, %s.", type, accept ? "stacking" : "returning");
+    }
+    return;
+  }
+  if (bill && code != CCTALK_BILL_STACKED) {
+    LOG_DEBUG("ccTalk: Bill type %u event code %u ignored.", type, code);
+    return;
+  }
+  if (value == 0) {
+    LOG_ERROR("ccTalk: %s accepted unknown type %u. Not credited.", device.name, type);
+    return;
+  }
+  CreditEvent event = { device.acceptor, type, value };
+  xQueueSend(creditEventQueue, &event, portMAX_DELAY); // Never drop money; the vending task drains quickly
+  notifyVendingTask(VENDING_EVENT_CREDIT);
+}
+
+/**
+ * @brief Applies the enables when the mask changed, after a failed poll (the device may have
+ *        reset meanwhile) and every CCTALK_REAPPLY_INTERVAL_MS, then processes new events,
+ *        oldest first. Marks the device offline after CCTALK_MAX_FAILURES failed polls or when
+ *        it reports a reset.
+ */
+void pollCcTalkDevice(CcTalkDevice& device) {
+  bool bill = device.acceptor == PULSE_ACCEPTOR_BILL;
+  CcTalkEvents events;
+  int result = CCTALK_ERR_TIMEOUT;
+  bool reapply = device.enableMask != device.appliedMask || device.failures > 0 ||
+                 millis() - device.lastApply >= CCTALK_REAPPLY_INTERVAL_MS;
+  if (!reapply || applyCcTalkEnables(device)) {
+    result = ccTalkBus.readEvents(device.address, bill, device.eventCounter, events);
+  }
+  if (result < 0) {
+    if (++device.failures >= CCTALK_MAX_FAILURES) {
+      device.online = false;
+      LOG_WARN("ccTalk: %s not responding. Coins/bills cannot be accepted.", device.name);
+    }
+    return;
+  }
+  device.failures = 0;
+
+  if (events.reset) {
+    device.online = false; // Power cycled: type table and inhibits are back to defaults
+    LOG_WARN("ccTalk: %s was reset. Setting it up again.", device.name);
+    return;
+  }
+  if (events.lost > 0) {
+    device.lost += events.lost;
+    LOG_ERROR("ccTalk: %s lost %d events (polled too late).", device.name, events.lost);
+  }
+  for (int i = 0; i < events.count; i++) handleCcTalkEvent(device, events.type[i], events.code[i]);
+  device.eventCounter = events.counter;
+}
+
+/**
+ * @brief Owns the ccTalk bus: sets devices up (and again after a reset or outage) and polls
+ *        their event buffers every CCTALK_POLL_INTERVAL_MS.
+ */
+void ccTalkTask(void* parameter) {
+  CcTalkDevice* devices[] = { &ccTalkCoin, &ccTalkBill };
+  for (;;) {
+    CcTalkMaskRequest request;
+    while (xQueueReceive(ccTalkMaskQueue, &request, 0) == pdTRUE) {
+      (request.acceptor == PULSE_ACCEPTOR_COIN ? ccTalkCoin : ccTalkBill).enableMask = request.mask; // Applied by the next poll
+    }
+    for (CcTalkDevice* device : devices) {
+      if (device->online) {
+        pollCcTalkDevice(*device);
+      } else if (millis() - device->lastSetupAttempt >= CCTALK_RETRY_INTERVAL_MS) {
+        device->lastSetupAttempt = millis();
+        if (!setupCcTalkDevice(*device)) LOG_DEBUG("ccTalk: %s not found at address %u.", device->name, device->address);
+      }
+    }
+    vTaskDelay(pdMS_TO_TICKS(CCTALK_POLL_INTERVAL_MS));
+  }
+}
+
+/**
+ * @brief Opens the ccTalk UART and starts the bus task (instead of initPulseCounters()).
+ */
+void initCcTalk() {
+  creditEventQueue = xQueueCreate(CREDIT_EVENT_QUEUE_LENGTH, sizeof(CreditEvent));
+  ccTalkMaskQueue = xQueueCreate(CCTALK_MASK_QUEUE_LENGTH, sizeof(CcTalkMaskRequest));
+  ccTalkSerial.begin(CCTALK_BAUD, SERIAL_8N1, CCTALK_RX_PIN, CCTALK_TX_PIN);
+  if (creditEventQueue == nullptr || ccTalkMaskQueue == nullptr ||
+      xTaskCreatePinnedToCore(ccTalkTask, "cctalk", CCTALK_TASK_STACK_SIZE, nullptr, CCTALK_TASK_PRIORITY, &ccTalkTaskHandle, CCTALK_TASK_CORE) != pdPASS) {
+    LOG_ERROR("Could not start ccTalk driver. Coins and bills will not be accepted.");
+    return;
+  }
+  LOG_INFO("ccTalk driver started (UART%d, RX %d, TX %d).", CCTALK_UART, CCTALK_RX_PIN, CCTALK_TX_PIN);
+}
+
+// =================================================================
+//                      CASHLESS PAYMENT
+// =================================================================
+
+/**
+ * @brief Interface to a card terminal. Only called from cashlessTask(), so implementations may
+ *        block briefly for I/O, but must not wait for the customer: the outcome of a payment is
+ *        reported later by poll().
+ */
+class CashlessProvider {
+public:
+  virtual ~CashlessProvider() {}
+  virtual const char* name() const = 0;
+  /** @brief Asks the terminal to collect amountCents. Returns false if the request could not be sent. */
+  virtual bool startPayment(uint32_t reference, uint16_t amountCents) = 0;
+  /** @brief Asks the terminal to abort the payment. The terminal answers CANCELLED or, if too late, APPROVED. */
+  virtual void cancelPayment(uint32_t reference) = 0;
+  /** @brief Returns the outcome of a payment once it is known, NONE otherwise. */
+  virtual CashlessOutcome poll(uint32_t& reference) = 0;
+  virtual bool online() = 0;
+};
+
+/**
+ * @brief Terminal (or ECR bridge) reached over TCP with a line protocol:
+ *        "PAY <ref> <cents>" and "CANCEL <ref>" out, "APPROVED|DECLINED|CANCELLED|ERROR <ref>" back.
+ *        tools/cashless_sim.py implements the terminal side for testing.
+ */
+class TcpCashlessProvider : public CashlessProvider {
+public:
+  const char* name() const override { return "TCP"; }
+
+  bool startPayment(uint32_t reference, uint16_t amountCents) override {
+    if (!ensureConnected()) return false;
+    pendingReference = reference;
+    client.printf("PAY %lu %u\n", (unsigned long)reference, amountCents);
+    return true;
+  }
+
+  void cancelPayment(uint32_t reference) override {
+    if (client.connected()) client.printf("CANCEL %lu\n", (unsigned long)reference);
+  }
+
+  CashlessOutcome poll(uint32_t& reference) override {
+    if (!client.connected()) {
+      ensureConnected();
+      if (pendingReference == 0) return CashlessOutcome::NONE;
+      // Lost the terminal mid-payment: the result is unknown, treat it as failed
+      reference = pendingReference;
+      pendingReference = 0;
+      LOG_ERROR("Cashless: Connection lost during payment %lu. Check the terminal journal.", (unsigned long)reference);
+      return CashlessOutcome::FAILED;
+    }
+    while (client.available() > 0) {
+      char c = (char)client.read();
+      if (c == '\r') continue;
+      if (c != '\n') {
+        if (lineLength < sizeof(line) - 1) line[lineLength++] = c;
+        continue;
+      }
+      line[lineLength] = '\0';
+      lineLength = 0;
+      CashlessOutcome outcome = parseLine(reference);
+      if (outcome != CashlessOutcome::NONE) {
+        if (reference == pendingReference) pendingReference = 0;
+        return outcome;
+      }
+    }
+    return CashlessOutcome::NONE;
+  }
+
+  bool online() override { return client.connected(); }
+
+private:
+  WiFiClient client;
+  char line[48];
+  size_t lineLength = 0;
+  uint32_t pendingReference = 0;
+  unsigned long lastConnectAttempt = 0;
+  bool everAttempted = false;
+
+  bool ensureConnected() {
+    if (client.connected()) return true;
+    if (everAttempted && millis() - lastConnectAttempt < CASHLESS_RECONNECT_INTERVAL_MS) return false;
+    everAttempted = true;
+    lastConnectAttempt = millis();
+    if (WiFi.status() != WL_CONNECTED) return false;
+
+    char host[CASHLESS_HOST_MAX_LEN];
+    xSemaphoreTake(cashlessConfigMutex, portMAX_DELAY);
+    memcpy(host, cashlessHost, sizeof(host));
+    uint16_t port = cashlessPort;
+    xSemaphoreGive(cashlessConfigMutex);
+    if (host[0] == '\0') return false;
+
+    client.stop();
+    lineLength = 0;
+    if (!client.connect(host, port, CASHLESS_CONNECT_TIMEOUT_MS)) {
+      LOG_DEBUG("Cashless: Terminal %s:%u not reachable.", host, port);
+      return false;
+    }
+    client.setNoDelay(true);
+    LOG_INFO("Cashless: Connected to terminal %s:%u.", host, port);
+    return true;
+  }
+
+  CashlessOutcome parseLine(uint32_t& reference) {
+    char word[12];
+    unsigned long ref = 0;
+    if (sscanf(line, "%11s %lu", word, &ref) != 2) {
+      if (line[0] != '\0') LOG_WARN("Cashless: Unknown terminal message '%s'.", line);
+      return CashlessOutcome::NONE;
+    }
+    reference = (uint32_t)ref;
+    if (strcmp(word, "APPROVED") == 0) return CashlessOutcome::APPROVED;
+    if (strcmp(word, "DECLINED") == 0) return CashlessOutcome::DECLINED;
+    if (strcmp(word, "CANCELLED") == 0) return CashlessOutcome::CANCELLED;
+    if (strcmp(word, "ERROR") == 0) return CashlessOutcome::FAILED;
+    LOG_WARN("Cashless: Unknown terminal message '%s'.", line);
+    return CashlessOutcome::NONE;
+  }
+};
+
+/**
+ * @brief Owns the terminal connection: forwards requests from the vending task to the provider
+ *        and hands the outcomes back through cashlessResultQueue.
+ */
+void cashlessTask(void* parameter) {
+  for (;;) {
+    CashlessRequest request;
+    if (xQueueReceive(cashlessRequestQueue, &request, pdMS_TO_TICKS(CASHLESS_POLL_INTERVAL_MS)) == pdTRUE) {
+      if (request.type == CashlessRequestType::CANCEL) {
+        cashlessProvider->cancelPayment(request.reference);
+      } else if (!cashlessProvider->startPayment(request.reference, request.amountCents)) {
+        CashlessResult result = { request.reference, CashlessOutcome::FAILED };
+        xQueueSend(cashlessResultQueue, &result, portMAX_DELAY);
+        notifyVendingTask(VENDING_EVENT_CASHLESS);
+      }
+    }
+    if (!cashlessIsEnabled()) {
+      cashlessOnline = false;
+      continue;
+    }
+
+    CashlessResult result = { 0, CashlessOutcome::NONE };
+    result.outcome = cashlessProvider->poll(result.reference);
+    if (result.outcome != CashlessOutcome::NONE) {
+      xQueueSend(cashlessResultQueue, &result, portMAX_DELAY);
+      notifyVendingTask(VENDING_EVENT_CASHLESS);
+    }
+    bool online = cashlessProvider->online();
+    if (cashlessOnline.exchange(online) != online) notifyVendingTask(VENDING_EVENT_CASHLESS); // Refresh "# Mit Karte zahlen"
+  }
+}
+
+/**
+ * @brief Creates the terminal provider and its task. The task idles while cashless is disabled.
+ */
+void initCashless() {
+  cashlessProvider = new TcpCashlessProvider();
+  cashlessRequestQueue = xQueueCreate(CASHLESS_QUEUE_LENGTH, sizeof(CashlessRequest));
+  cashlessResultQueue = xQueueCreate(CASHLESS_QUEUE_LENGTH, sizeof(CashlessResult));
+  cashlessConfigMutex = xSemaphoreCreateMutex();
+  cashlessReferenceCounter = esp_random();
+  if (cashlessProvider == nullptr || cashlessRequestQueue == nullptr || cashlessResultQueue == nullptr || cashlessConfigMutex == nullptr ||
+      xTaskCreatePinnedToCore(cashlessTask, "cashless", CASHLESS_TASK_STACK_SIZE, nullptr, 1, &cashlessTaskHandle, CASHLESS_TASK_CORE) != pdPASS) {
+    LOG_ERROR("Could not start cashless payment task.");
+    cashlessEnabled = false;
+    return;
+  }
+  LOG_INFO("Cashless payment %s (%s terminal).", cashlessEnabled ? "enabled" : "disabled", cashlessProvider->name());
+}
+
+/**
+ * @brief Reads the enable switch written by the web handler.
+ */
+bool cashlessIsEnabled() {
+  xSemaphoreTake(cashlessConfigMutex, portMAX_DELAY);
+  bool enabled = cashlessEnabled;
+  xSemaphoreGive(cashlessConfigMutex);
+  return enabled;
+}
+
+/**
+ * @brief True if a card payment can be offered right now.
+ */
+bool cashlessAvailable() {
+  return cashlessIsEnabled() && cashlessOnline && cashlessSession.state == CashlessState::IDLE && !dispenseQueueFull();
+}
+
+/**
+ * @brief Starts a card payment for the part of the slot price not covered by credit.
+ */
+void startCashlessSession(int slot) {
+  if (pulseLearn.active) {
+    displayErrorMessage("Lernmodus", "kein Verkauf");
+    return;
+  }
+  if (!checkRelayBoardOnline()) { // Check before charging the card
+    displayErrorMessage("Relais Fehler", "Board offline");
+    return;
+  }
+  long amountCents = lroundf((slotPrices[slot] - credit) * 100.0f);
+  if (amountCents <= 0 || amountCents > UINT16_MAX) return;
+
+  if (++cashlessReferenceCounter == 0) cashlessReferenceCounter++; // 0 means "no payment" to the provider
+  CashlessRequest request = { CashlessRequestType::PAY, cashlessReferenceCounter, (uint16_t)amountCents };
+  if (xQueueSend(cashlessRequestQueue, &request, 0) != pdTRUE) {
+    displayErrorMessage("Kartenzahlung", "nicht moeglich");
+    return;
+  }
+  cashlessSession.state = CashlessState::WAITING;
+  cashlessSession.slot = slot;
+  cashlessSession.reference = request.reference;
+  cashlessSession.amountCents = request.amountCents;
+  cashlessSession.deadline = millis() + CASHLESS_SESSION_TIMEOUT_MS;
+  cashlessSession.timedOut = false;
+  cashlessSession.approved = false;
+  LOG_INFO("Cashless: Payment %lu started for slot %d: %.2f EUR.", (unsigned long)request.reference, slot + 1, amountCents / 100.0);
+  displayNeedsUpdate = true;
+}
+
+/**
+ * @brief Asks the terminal to abort the running payment. The session ends once it confirms.
+ */
+void cancelCashlessSession() {
+  if (cashlessSession.state != CashlessState::WAITING) return;
+  CashlessRequest request = { CashlessRequestType::CANCEL, cashlessSession.reference, 0 };
+  xQueueSend(cashlessRequestQueue, &request, 0);
+  cashlessSession.state = CashlessState::CANCELLING;
+  cashlessSession.deadline = millis() + CASHLESS_CANCEL_TIMEOUT_MS;
+  LOG_INFO("Cashless: Cancelling payment %lu.", (unsigned long)cashlessSession.reference);
+  displayNeedsUpdate = true;
+}
+
+/**
+ * @brief The last payment was approved after its session ended (cancel too late, or no answer
+ *        to the cancel in time). The card is charged, so the amount goes to credit.
+ */
+void bookLateCashlessApproval() {
+  cashlessSession.approved = true;
+  credit += cashlessSession.amountCents / 100.0f;
+  markCreditChanged();
+  lastUserInteractionTime = millis();
+  currentSystemState = CurrentSystemState::USER_INTERACTION;
+  LOG_ERROR("Cashless: Late approval for payment %lu, %.2f EUR added to credit.", (unsigned long)cashlessSession.reference,
+            cashlessSession.amountCents / 100.0);
+  sendTelegramMessage("⚠️ KARTENZAHLUNG: Verspätete Freigabe über " + String(cashlessSession.amountCents / 100.0, 2) +
+                      " EUR als Guthaben gebucht. Bitte prüfen.");
+}
+
+/**
+ * @brief Advances the card payment session: applies terminal outcomes and handles the timeouts.
+ */
+void processCashlessSession() {
+  if (cashlessResultQueue == nullptr) return;
+
+  CashlessResult result;
+  while (xQueueReceive(cashlessResultQueue, &result, 0) == pdTRUE) {
+    displayNeedsUpdate = true;
+    if (result.reference != cashlessSession.reference) {
+      if (result.outcome == CashlessOutcome::APPROVED) {
+        LOG_ERROR("Cashless: Approval for unknown payment %lu. Refund it at the terminal.", (unsigned long)result.reference);
+      }
+      continue;
+    }
+    if (cashlessSession.state == CashlessState::IDLE) {
+      if (result.outcome == CashlessOutcome::APPROVED && !cashlessSession.approved) {
+        bookLateCashlessApproval();
+      }
+      continue;
+    }
+    cashlessSession.state = CashlessState::IDLE;
+    lastUserInteractionTime = millis();
+    int slot = cashlessSession.slot;
+
+    switch (result.outcome) {
+      case CashlessOutcome::APPROVED:
+        // Approval wins over a cancel that came too late: the customer has paid
+        cashlessSession.approved = true;
+        LOG_INFO("Cashless: Payment %lu approved.", (unsigned long)result.reference);
+        if (!scheduleDispense(slot, cashlessSession.amountCents)) {
+          credit += cashlessSession.amountCents / 100.0f;
+          markCreditChanged();
+          LOG_WARN("Cashless: Dispense not possible, %.2f EUR added to credit.", cashlessSession.amountCents / 100.0);
+        }
+        break;
+      case CashlessOutcome::DECLINED:
+        LOG_INFO("Cashless: Payment %lu declined.", (unsigned long)result.reference);
+        displayErrorMessage("Karte", "abgelehnt!");
+        break;
+      case CashlessOutcome::CANCELLED:
+        LOG_INFO("Cashless: Payment %lu cancelled.", (unsigned long)result.reference);
+        displayErrorMessage("Zahlung", cashlessSession.timedOut ? "Zeit abgelaufen" : "abgebrochen");
+        break;
+      default:
+        LOG_WARN("Cashless: Payment %lu failed.", (unsigned long)result.reference);
+        displayErrorMessage("Kartenzahlung", "nicht moeglich");
+        break;
+    }
+  }
+
+  if (cashlessSession.state == CashlessState::IDLE || (long)(millis() - cashlessSession.deadline) < 0) return;
+  if (cashlessSession.state == CashlessState::WAITING) {
+    LOG_INFO("Cashless: Payment %lu timed out.", (unsigned long)cashlessSession.reference);
+    cashlessSession.timedOut = true;
+    cancelCashlessSession();
+  } else {
+    LOG_ERROR("Cashless: Terminal did not confirm cancel of payment %lu. Check the terminal journal.", (unsigned long)cashlessSession.reference);
+    cashlessSession.state = CashlessState::IDLE;
+    displayErrorMessage("Kartenzahlung", "Status unklar");
+  }
+}
+
+// =================================================================
+//                      CROSS-CORE COMMUNICATION
+// =================================================================
+
+/**
+ * @brief Publishes the current vending state for the web UI (seqlock writer, vending task only).
+ */
+void publishVendingSnapshot() {
+  uint32_t seq = vendingSnapshotSeq.load(std::memory_order_relaxed);
+  vendingSnapshotSeq.store(seq + 1, std::memory_order_relaxed); // Odd: write in progress
+  std::atomic_thread_fence(std::memory_order_release);
+
+  vendingSnapshot.credit = credit;
+  vendingSnapshot.activeSlots = activeSlots;
+  memcpy(vendingSnapshot.slotPrices, slotPrices, sizeof(slotPrices));
+  memcpy(vendingSnapshot.slotAvailable, slotAvailable, sizeof(slotAvailable));
+  memcpy(vendingSnapshot.slotLocked, slotLocked, sizeof(slotLocked));
+  vendingSnapshot.dispenseActive = dispenseQueueBusy();
+  vendingSnapshot.dispenseSlot = dispenseCount > 0 ? dispenseJobAt(0).slot : -1;
+
+  vendingSnapshotSeq.store(seq + 2, std::memory_order_release);
+}
+
+/**
+ * @brief Returns a consistent copy of the latest vending state (seqlock reader, any task).
+ */
+VendingSnapshot readVendingSnapshot() {
+  VendingSnapshot snap;
+  uint32_t before, after;
+  do {
+    before = vendingSnapshotSeq.load(std::memory_order_acquire);
+    memcpy(&snap, &vendingSnapshot, sizeof(snap));
+    std::atomic_thread_fence(std::memory_order_acquire);
+    after = vendingSnapshotSeq.load(std::memory_order_relaxed);
+  } while ((before & 1) || before != after);
+  return snap;
+}
+
+/**
+ * @brief Queues a command for the vending task without waiting.
+ * @return False if the command queue is full.
+ */
+bool postVendingCommand(VendingCommandType type, int slot, float value) {
+  if (vendingCommandQueue == nullptr) return false;
+  VendingCommand cmd = { type, slot, value };
+  if (xQueueSend(vendingCommandQueue, &cmd, 0) != pdTRUE) {
+    LOG_ERROR("Vending command queue full. Command dropped.");
+    return false;
+  }
+  notifyVendingTask(VENDING_EVENT_COMMAND);
+  return true;
+}
+
+/**
+ * @brief Applies all pending web commands to the vending state and persists them (vending task).
+ */
+void processVendingCommands() {
+  VendingCommand cmd;
+  while (xQueueReceive(vendingCommandQueue, &cmd, 0) == pdTRUE) {
+    switch (cmd.type) {
+      case VendingCommandType::SET_PRICE:
+        if (cmd.slot >= 0 && cmd.slot < activeSlots && cmd.value >= 0) {
+          slotPrices[cmd.slot] = cmd.value;
+          markSlotTableChanged();
+          LOG_INFO("Web: Price for slot %d changed to %.2f EUR.", cmd.slot + 1, cmd.value);
+        }
+        break;
+
+      case VendingCommandType::REFILL_SLOT:
+        if (cmd.slot >= 0 && cmd.slot < activeSlots && !slotLocked[cmd.slot]) {
+          slotAvailable[cmd.slot] = true;
+          markSlotTableChanged();
+          LOG_INFO("Web: Slot %d refilled.", cmd.slot + 1);
+          checkOverallStockLevel();
+        }
+        break;
+
+      case VendingCommandType::REFILL_ALL:
+        for (int i = 0; i < activeSlots; i++) {
+          if (!slotLocked[i]) {
+              slotAvailable[i] = true;
+              markSlotTableChanged();
+          }
+        }
+        LOG_INFO("Web: All unlocked slots have been refilled.");
+        checkOverallStockLevel();
+        break;
+
+      case VendingCommandType::ADJUST_CREDIT:
+        credit += cmd.value;
+        sessionManualCents += (int32_t)lroundf(cmd.value * 100.0f);
+        markCreditChanged();
+        LOG_INFO("Web: Credit adjusted by %.2f EUR. New credit: %.2f EUR.", cmd.value, credit);
+        break;
+
+      case VendingCommandType::RESET_CREDIT:
+        credit = 0.0;
+        sessionCoinCents = 0; sessionBillEuros = 0; sessionManualCents = 0;
+        markCreditChanged();
+        LOG_INFO("Web: Credit reset to 0.");
+        break;
+
+      case VendingCommandType::TOGGLE_SLOT_LOCK:
+        if (cmd.slot >= 0 && cmd.slot < activeSlots) {
+          slotLocked[cmd.slot] = !slotLocked[cmd.slot];
+          markSlotTableChanged();
+          LOG_INFO("Web: Slot %d %s.", cmd.slot + 1, slotLocked[cmd.slot] ? "locked" : "unlocked");
+        }
+        break;
+
+      case VendingCommandType::SET_ACTIVE_SLOTS:
+        if (cmd.slot > 0 && cmd.slot <= MAX_SLOTS) {
+          activeSlots = cmd.slot; // The slot table always holds all MAX_SLOTS entries
+          markSlotTableChanged();
+          applyDoorSensors(); // Free expander pins have changed
+          LOG_INFO("Web: Number of active slots set to %d", activeSlots);
+        }
+        break;
+
+      case VendingCommandType::TEST_RELAY:
+        if (cmd.slot >= 0 && cmd.slot < activeSlots) {
+          LOG_INFO("Web: Testing relay for slot %d", cmd.slot + 1);
+          startRelayTest(cmd.slot, cmd.slot, 1000, 0);
+        }
+        break;
+
+      case VendingCommandType::TEST_ALL_RELAYS:
+        LOG_INFO("Web: Testing all relays...");
+        startRelayTest(0, activeSlots - 1, 300, 100);
+        break;
+
+      case VendingCommandType::RELOAD_DISPLAY_TEXTS:
+        preferences.begin("hanimat", true);
+        displaySlogan = preferences.getString("dispSlogan", "");
+        displayFooter = preferences.getString("dispFooter", "www.hanimat.at");
+        preferences.end();
+        break;
+
+      case VendingCommandType::FLUSH_SETTINGS:
+        commitSettingsCache();
+        break;
+
+      case VendingCommandType::SET_COIN_PULSE_VALUE:
+      case VendingCommandType::SET_BILL_PULSE_VALUE:
+        if (cmd.slot > 0 && cmd.slot < PULSE_TABLE_SIZE && cmd.value >= 0) {
+          bool coin = cmd.type == VendingCommandType::SET_COIN_PULSE_VALUE;
+          (coin ? pulseValues : billValues)[cmd.slot] = pulseTableUnits(coin ? PULSE_ACCEPTOR_COIN : PULSE_ACCEPTOR_BILL, cmd.value);
+          savePulseTables();
+          LOG_INFO("Web: %s with %d pulses set to %.2f EUR.", coin ? "Coin" : "Bill", cmd.slot, cmd.value);
+        }
+        break;
+
+      case VendingCommandType::START_PULSE_LEARN:
+        if (cmd.slot >= 0 && cmd.slot < PULSE_ACCEPTOR_COUNT && cmd.value > 0) {
+          if (!pulseLearn.active) pulseLearn = {}; // New session: forget earlier measurements
+          pulseLearn.active = true;
+          pulseLearn.acceptor = cmd.slot;
+          pulseLearn.value = pulseTableUnits(cmd.slot, cmd.value);
+          pulseLearn.lastPulses = 0;
+          pulseLearn.conflictPulses = 0;
+          pulseLearn.lastActivity = millis();
+          displayNeedsUpdate = true;
+          LOG_INFO("Learn: Insert %s of %.2f EUR now. Sales are blocked.", cmd.slot == PULSE_ACCEPTOR_COIN ? "coin" : "bill", cmd.value);
+        }
+        break;
+
+      case VendingCommandType::STOP_PULSE_LEARN:
+        if (pulseLearn.active) stopPulseLearn();
+        break;
+
+      case VendingCommandType::CONFIRM_PULSE_LEARN:
+        if (pulseLearn.active && pulseLearn.conflictPulses > 0) {
+          LOG_INFO("Learn: Overwrite of %d pulses confirmed.", pulseLearn.conflictPulses);
+          storeLearnedGroup(pulseLearn.conflictPulses, pulseLearn.conflictIntervalUs);
+          pulseLearn.conflictPulses = 0;
+          pulseLearn.lastActivity = millis();
+          displayNeedsUpdate = true;
+        }
+        break;
+
+      case VendingCommandType::APPLY_LEARNED_TIMEOUTS:
+        applyLearnedTimeouts();
+        break;
+
+      case VendingCommandType::SET_DOOR_SENSOR:
+        if (cmd.slot >= 0 && cmd.slot < activeSlots) {
+          doorSensors[cmd.slot] = (uint8_t)cmd.value;
+          saveDoorSensors();
+          applyDoorSensors();
+          LOG_INFO("Web: Door sensor of slot %d set to %u.", cmd.slot + 1, doorSensors[cmd.slot]);
+        }
+        break;
+
+      case VendingCommandType::SET_DOOR_OPEN_LEVEL:
+        doorOpenHigh = cmd.value != 0;
+        saveDoorSensors();
+        LOG_INFO("Web: Door sensors report open on %s.", doorOpenHigh ? "HIGH" : "LOW");
+        break;
+    }
+    displayNeedsUpdate = true;
+  }
+}
+
+/**
+ * @brief Starts a non-blocking relay test over a range of slots.
+ * @param firstSlot First slot index to test.
+ * @param lastSlot Last slot index to test (inclusive).
+ * @param onTime Time each relay stays on (ms).
+ * @param offTime Pause between two relays (ms).
+ */
+void startRelayTest(int firstSlot, int lastSlot, unsigned long onTime, unsigned long offTime) {
+  if (relayTestJob.active) {
+    LOG_WARN("Relay test: Test already running. New request ignored.");
+    return;
+  }
+  relayTestJob.active = true;
+  relayTestJob.slot = firstSlot;
+  relayTestJob.lastSlot = lastSlot;
+  relayTestJob.relayOn = false;
+  relayTestJob.onTime = onTime;
+  relayTestJob.offTime = offTime;
+  relayTestJob.phaseStart = millis() - offTime; // First relay switches immediately
+}
+
+/**
+ * @brief Steps the running relay test: relay on, wait, relay off, pause, next slot.
+ */
+void processRelayTestJob() {
+  if (!relayTestJob.active) return;
+
+  unsigned long now = millis();
+  if (!relayTestJob.relayOn) {
+    if (now - relayTestJob.phaseStart >= relayTestJob.offTime) {
+      controlSlotRelay(relayTestJob.slot, true);
+      relayTestJob.relayOn = true;
+      relayTestJob.phaseStart = now;
+    }
+  } else if (now - relayTestJob.phaseStart >= relayTestJob.onTime) {
+    controlSlotRelay(relayTestJob.slot, false);
+    relayTestJob.relayOn = false;
+    relayTestJob.phaseStart = now;
+    relayTestJob.slot++;
+    if (relayTestJob.slot > relayTestJob.lastSlot) {
+      relayTestJob.active = false;
+      LOG_INFO("Relay test finished.");
+    }
+  }
+}
+
+/**
+ * @brief Posts a message for the TFT from the network side. Replaces any message not yet shown.
+ */
+void postTftMessage(const char* line1, const char* line2, const char* line3, uint16_t color) {
+  if (tftMessageQueue == nullptr) return;
+  TftMessage msg;
+  strncpy(msg.line1, line1, sizeof(msg.line1) - 1); msg.line1[sizeof(msg.line1) - 1] = '\0';
+  strncpy(msg.line2, line2, sizeof(msg.line2) - 1); msg.line2[sizeof(msg.line2) - 1] = '\0';
+  strncpy(msg.line3, line3, sizeof(msg.line3) - 1); msg.line3[sizeof(msg.line3) - 1] = '\0';
+  msg.color = color;
+  xQueueOverwrite(tftMessageQueue, &msg);
+  notifyVendingTask(VENDING_EVENT_COMMAND);
+}
+
+/**
+ * @brief Shows pending TFT messages (OTA progress) and leaves the OTA screen once the update is over.
+ */
+void processTftMessages() {
+  TftMessage msg;
+  if (xQueueReceive(tftMessageQueue, &msg, 0) == pdTRUE) {
+    currentSystemState = CurrentSystemState::OTA_UPDATE;
+    lastTftMessageTime = millis();
+    displayOTAMessageTFT(msg.line1, msg.line2, msg.line3, msg.color);
+  } else if (currentSystemState == CurrentSystemState::OTA_UPDATE && !otaUpdateInProgress &&
+             millis() - lastTftMessageTime > 5000) {
+    resetDisplayToDefault(); // Update failed or was aborted
+  }
+}
+
+// =================================================================
+//                      DISPLAY WIDGETS
+// =================================================================
+
+/**
+ * @brief Marks all widgets as stale, e.g. after an error, OTA or dispense screen covered them.
+ *        The next widget frame is composed over the whole screen. Display task only.
+ */
+void invalidateDisplayWidgets() {
+  displayWidgetsNeedClear = true;
+  for (int i = 0; i < DISPLAY_REGION_COUNT; i++) displayWidgets[i].valid = false;
+}
+
+/**
+ * @brief Composes a screen rectangle strip by strip into stripCanvas and pushes each strip
+ *        to the TFT in one burst. The rectangle is never cleared on the glass first, so there
+ *        is no flicker. Items outside the current strip are skipped. Display task only.
+ */
+void composeDisplayRect(int16_t x, int16_t y, int16_t w, int16_t h, const DisplayItem* items, int count) {
+  int16_t cursorX[DISPLAY_MAX_ITEMS], top[DISPLAY_MAX_ITEMS], bottom[DISPLAY_MAX_ITEMS];
+  const int16_t stride = stripCanvas->width();
+
+  // Resolve position and vertical extent of every item once
+  for (int i = 0; i < count; i++) {
+    if (items[i].font == nullptr) {
+      cursorX[i] = items[i].x;
+      top[i] = items[i].baseline - DISPLAY_DOT_RADIUS;
+      bottom[i] = items[i].baseline + DISPLAY_DOT_RADIUS + 1;
+      continue;
+    }
+    int16_t x1, y1; uint16_t tw, th;
+    stripCanvas->setFont(items[i].font);
+    stripCanvas->getTextBounds(items[i].text, 0, items[i].baseline, &x1, &y1, &tw, &th);
+    cursorX[i] = (items[i].x < 0) ? (stride - tw) / 2 : items[i].x;
+    top[i] = y1;
+    bottom[i] = y1 + th;
+  }
+
+  tft.startWrite();
+  for (int16_t stripY = y; stripY < y + h; stripY += DISPLAY_STRIP_HEIGHT) {
+    int16_t stripH = min<int16_t>(DISPLAY_STRIP_HEIGHT, y + h - stripY);
+    stripCanvas->fillScreen(ILI9341_BLACK);
+    for (int i = 0; i < count; i++) {
+      if (bottom[i] <= stripY || top[i] >= stripY + stripH) continue;
+      if (items[i].font == nullptr) {
+        stripCanvas->fillCircle(cursorX[i], items[i].baseline - stripY, DISPLAY_DOT_RADIUS, items[i].color);
+      } else {
+        stripCanvas->setFont(items[i].font);
+        stripCanvas->setTextColor(items[i].color);
+        stripCanvas->setCursor(cursorX[i], items[i].baseline - stripY);
+        stripCanvas->print(items[i].text);
+      }
+    }
+
+    uint16_t* pixels = stripCanvas->getBuffer();
+    tft.setAddrWindow(x, stripY, w, stripH);
+    if (x == 0 && w == stride) {
+      tft.writePixels(pixels, (uint32_t)w * stripH);
+    } else {
+      for (int16_t row = 0; row < stripH; row++) tft.writePixels(pixels + row * stride + x, w);
+    }
+  }
+  tft.endWrite();
+}
+
+/**
+ * @brief Appends the drawable items of a widget's content to items. Returns the item count.
+ */
+int collectWidgetItems(DisplayRegion region, const WidgetContent& content, DisplayItem* items) {
+  const DisplayWidget& widget = displayWidgets[region];
+  if (region == DISPLAY_REGION_STATUS) {
+    if (content.colors[0] == 0) return 0;
+    items[0] = { nullptr, content.colors[0], (int16_t)(widget.x + widget.w / 2), (int16_t)(widget.y + widget.h / 2), "" };
+    return 1;
+  }
+  int count = 0;
+  for (int line = 0; line < DISPLAY_WIDGET_LINES; line++) {
+    if (content.lines[line][0] == '\0') continue;
+    DisplayItem& item = items[count++];
+    item.font = widget.font;
+    item.color = content.colors[line];
+    item.x = widget.centered ? -1 : widget.x + 10;
+    item.baseline = widget.y + widget.baseline + line * widget.lineSpacing;
+    memcpy(item.text, content.lines[line], sizeof(item.text)); // Same DISPLAY_WIDGET_TEXT_LEN
+  }
+  return count;
+}
+
+/**
+ * @brief Shows new content in a region. Repaints only that region's rectangle, and only if
+ *        the content differs from what was painted last time. Display task only.
+ */
+void updateDisplayWidget(DisplayRegion region, const WidgetContent& content) {
+  DisplayWidget& widget = displayWidgets[region];
+  if (widget.valid && memcmp(&widget.shown, &content, sizeof(content)) == 0) return;
+
+  DisplayItem items[DISPLAY_WIDGET_LINES];
+  int count = collectWidgetItems(region, content, items);
+  composeDisplayRect(widget.x, widget.y, widget.w, widget.h, items, count);
+  widget.shown = content;
+  widget.valid = true;
+}
+
+/**
+ * @brief Puts a frame on the glass. Widget frames repaint changed regions only, or the whole
+ *        screen in one pass after an overlay; overlays always replace the whole screen.
+ */
+void renderDisplayFrame(const DisplayFrame& frame) {
+  static DisplayItem items[DISPLAY_MAX_ITEMS];
+  if (frame.type == DisplayFrameType::OVERLAY) {
+    composeDisplayRect(0, 0, tft.width(), tft.height(), frame.overlay, frame.overlayCount);
+    invalidateDisplayWidgets();
+    return;
+  }
+
+  if (displayWidgetsNeedClear) {
+    int count = 0;
+    for (int i = 0; i < DISPLAY_REGION_COUNT; i++) {
+      count += collectWidgetItems((DisplayRegion)i, frame.widgets[i], items + count);
+      displayWidgets[i].shown = frame.widgets[i];
+      displayWidgets[i].valid = true;
+    }
+    composeDisplayRect(0, 0, tft.width(), tft.height(), items, count);
+    displayWidgetsNeedClear = false;
+    return;
+  }
+  for (int i = 0; i < DISPLAY_REGION_COUNT; i++) updateDisplayWidget((DisplayRegion)i, frame.widgets[i]);
+}
+
+/**
+ * @brief Owns the TFT after setup(). Waits for frames from the vending task and renders
+ *        them, so a redraw never holds up coin, keypad or dispense handling.
+ */
+void displayTask(void* parameter) {
+  static DisplayFrame frame;
+  static DisplayFrame next;
+  stripCanvas->setTextWrap(false);
+
+  for (;;) {
+    if (xQueueReceive(displayFrameQueue, &frame, portMAX_DELAY) != pdTRUE) continue;
+    // Back-to-back widget frames: only the newest one matters
+    while (frame.type == DisplayFrameType::WIDGETS && xQueuePeek(displayFrameQueue, &next, 0) == pdTRUE &&
+           next.type == DisplayFrameType::WIDGETS) {
+      xQueueReceive(displayFrameQueue, &frame, 0);
+    }
+    renderDisplayFrame(frame);
+  }
+}
+
+/**
+ * @brief Hands a frame to the display task without blocking. If the display is behind,
+ *        the oldest queued frame is dropped. Vending task only.
+ */
+void postDisplayFrame(const DisplayFrame& frame) {
+  static DisplayFrame dropped;
+  if (displayFrameQueue == nullptr) return;
+  if (xQueueSend(displayFrameQueue, &frame, 0) != pdTRUE) {
+    xQueueReceive(displayFrameQueue, &dropped, 0);
+    xQueueSend(displayFrameQueue, &frame, 0);
+  }
+}
+
+/**
+ * @brief Starts an empty full-screen overlay frame.
+ */
+void beginDisplayOverlay(DisplayFrame& frame) {
+  frame.type = DisplayFrameType::OVERLAY;
+  frame.overlayCount = 0;
+}
+
+/**
+ * @brief Adds a printf-style text line to an overlay frame. x = -1 centers the line.
+ */
+void addOverlayItem(DisplayFrame& frame, const GFXfont* font, uint16_t color, int16_t x, int16_t baseline, const char* format, ...) {
+  if (frame.overlayCount >= DISPLAY_OVERLAY_ITEMS) return;
+  DisplayItem& item = frame.overlay[frame.overlayCount++];
+  item.font = font;
+  item.color = color;
+  item.x = x;
+  item.baseline = baseline;
+  va_list args;
+  va_start(args, format);
+  vsnprintf(item.text, sizeof(item.text), format, args);
+  va_end(args);
+}
+
+/**
+ * @brief Sets one line of a widget content with printf-style formatting.
+ */
+void setWidgetLine(WidgetContent& content, int line, uint16_t color, const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  vsnprintf(content.lines[line], DISPLAY_WIDGET_TEXT_LEN, format, args);
+  va_end(args);
+  content.colors[line] = color;
+}
+
+
+// =================================================================
+//                      CORE LOGIC IMPLEMENTATION
+// =================================================================
+
+char manualGetKeyState() {
+  char currentPhysicalKey = 0;
+
+  // Iterate through rows
+  for (int r = 0; r < KEYPAD_ROWS; r++) {
+    digitalWrite(rowPins[r], HIGH); // Activate one row
+    // Check all columns in that row
+    for (int c = 0; c < KEYPAD_COLS; c++) {
+      if (digitalRead(colPins[c]) == HIGH) {
+        currentPhysicalKey = keys[r][c];
+        break;
+      }
+    }
+    digitalWrite(rowPins[r], LOW); // Deactivate the row
+    if (currentPhysicalKey != 0) {
+      break;
+    }
+  }
+
+  unsigned long now = millis();
+
+  // Debounce logic
+  if (currentPhysicalKey != lastPhysicallyPressedKey) {
+    lastKeyPressTime = now;
+    lastPhysicallyPressedKey = currentPhysicalKey;
+    if (currentPhysicalKey == 0) {
+        lastReturnedKey = 0; // Reset returned key when released
+    }
+    return 0; // Return nothing on initial press/release
+  }
+
+  // If key is held down longer than the debounce period, return it once
+  if (currentPhysicalKey != 0 && (now - lastKeyPressTime > KEYPAD_DEBOUNCE_PERIOD)) {
+    if (currentPhysicalKey != lastReturnedKey) {
+      lastReturnedKey = currentPhysicalKey;
+      return currentPhysicalKey;
+    }
+  }
+  
+  return 0; // No valid key press
+}
+
+/**
+ * @brief Sets up all web server endpoints (routes).
+ */
+void setupWebServer() {
+  static const char* collectedHeaders[] = { "If-None-Match" };
+  server.collectHeaders(collectedHeaders, 1);
+
+  server.on("/", HTTP_GET, handleRoot);
+  server.on("/login", HTTP_POST, handleLogin);
+  server.on("/logdata", HTTP_GET, handleLogDataRequest);
+  server.on("/salesdata", HTTP_GET, handleSalesDataRequest);
+
+  // JSON API used by the admin app (GET returns state, POST takes a JSON object)
+  server.on("/api/state", HTTP_GET, handleApiState);
+  server.on("/api/config", HTTP_GET, handleApiConfig);
+  server.on("/api/credit", HTTP_POST, handleApiCredit);
+  server.on("/api/slots/price", HTTP_POST, handleApiSlotPrice);
+  server.on("/api/slots/refill", HTTP_POST, handleApiSlotRefill);
+  server.on("/api/slots/lock", HTTP_POST, handleApiSlotLock);
+  server.on("/api/slots/test", HTTP_POST, handleApiSlotTest);
+  server.on("/api/slots/count", HTTP_POST, handleApiSlotCount);
+  server.on("/api/config/timing", HTTP_POST, handleApiTimingConfig);
+  server.on("/api/config/telegram", HTTP_POST, handleApiTelegramConfig);
+  server.on("/api/config/display", HTTP_POST, handleApiDisplayConfig);
+  server.on("/api/config/network", HTTP_POST, handleApiNetworkConfig);
+  server.on("/api/config/password", HTTP_POST, handleApiPassword);
+  server.on("/api/config/loglevel", HTTP_POST, handleApiLogLevel);
+  server.on("/api/telegram/test", HTTP_POST, handleApiTelegramTest);
+  server.on("/api/config/payment", HTTP_POST, handleApiPaymentTable);
+  server.on("/api/payment/learn", HTTP_POST, handleApiPaymentLearn);
+  server.on("/api/payment/learn/apply", HTTP_POST, handleApiPaymentLearnApply);
+  server.on("/api/payment/inhibit", HTTP_POST, handleApiPaymentInhibit);
+  server.on("/api/config/cashless", HTTP_POST, handleApiCashlessConfig);
+  server.on("/api/doors", HTTP_GET, handleApiDoors);
+  server.on("/api/config/doors", HTTP_POST, handleApiDoorConfig);
+
+  // OTA Upload Handler (the success path answers and restarts from handleOTAFileUpload)
+  server.on("/ota-upload", HTTP_POST, []() {
+    if (!requireApiAuth()) return;
+    sendApiResult(500, otaStatusMessage.length() > 0 ? otaStatusMessage.c_str() : "Update failed.");
+  }, handleOTAFileUpload);
+
+  // 404 Not Found Handler
+  server.onNotFound([]() {
+    server.send(404, "text/plain", "Page not found.");
+    LOG_INFO("HTTP 404: %s", server.uri().c_str());
+  });
+
+  server.begin();
+  LOG_INFO("Web server started.");
+}
+
+/**
+ * @brief Resets the system state and display to the default idle screen.
+ */
+void resetDisplayToDefault() {
+  selectedSlot = -1;
+  keypadInputBuffer = "";
+  currentSystemState = CurrentSystemState::IDLE; 
+  displayNeedsUpdate = true;
+  lastUserInteractionTime = millis();
+  commitSettingsCache(); // Back to idle: flush pending changes
+}
+
+/**
+ * @brief Updates the TFT display based on the current system state. Builds the content of
+ *        every region and posts it to the display task, which repaints changed regions only.
+ */
+void updateDisplayScreen() {
+  static DisplayFrame frame; // Only used by the vending task
+  frame.type = DisplayFrameType::WIDGETS;
+  frame.overlayCount = 0;
+  memset(frame.widgets, 0, sizeof(frame.widgets));
+
+  // --- Static Header ---
+  setWidgetLine(frame.widgets[DISPLAY_REGION_HEADER], 0, ILI9341_YELLOW, "HONIGAUTOMAT");
+
+  // --- WiFi Status Indicator ---
+  bool offlineModeActive = (digitalRead(OFFLINE_MODE_PIN) == LOW);
+  if (!offlineModeActive) {
+    frame.widgets[DISPLAY_REGION_STATUS].colors[0] = (WiFi.status() == WL_CONNECTED) ? ILI9341_GREEN : ILI9341_RED;
+  }
+
+  // --- Credit Display ---
+  setWidgetLine(frame.widgets[DISPLAY_REGION_CREDIT], 0, ILI9341_GREEN, "Guthaben: %.2f EUR", credit);
 
   // --- Dynamic Content Area ---
-  int y_dynamic_start = 110;
-  int line_spacing = 25;
-  tft.setFont(&Poppins_Regular10pt7b);
+  WidgetContent& content = frame.widgets[DISPLAY_REGION_PROMPT];
+  if (currentSystemState == CurrentSystemState::ERROR_DISPLAY) {
+    // Not repainted while the error overlay is up, see vendingTask().
+  } else if (pulseLearn.active) {
+    bool coin = pulseLearn.acceptor == PULSE_ACCEPTOR_COIN;
+    setWidgetLine(content, 0, ILI9341_YELLOW, "LERNMODUS");
+    setWidgetLine(content, 1, ILI9341_WHITE, coin ? "Muenze: %.2f EUR" : "Schein: %.0f EUR",
+                  coin ? pulseLearn.value / 100.0 : (double)pulseLearn.value);
+    if (pulseLearn.conflictPulses > 0) {
+      setWidgetLine(content, 2, ILI9341_RED, "%d Impulse belegt!", pulseLearn.conflictPulses);
+    } else if (pulseLearn.lastPulses > 0) {
+      setWidgetLine(content, 2, ILI9341_GREEN, "Gelernt: %d Impulse", pulseLearn.lastPulses);
+    } else {
+      setWidgetLine(content, 2, ILI9341_RED, "Kein Verkauf");
+    }
+  } else if (cashlessSession.state != CashlessState::IDLE) {
+    setWidgetLine(content, 0, ILI9341_CYAN, "Karte: %.2f EUR", cashlessSession.amountCents / 100.0);
+    if (cashlessSession.state == CashlessState::WAITING) {
+      setWidgetLine(content, 1, ILI9341_CYAN, "Bitte Karte vorhalten");
+      setWidgetLine(content, 2, ILI9341_WHITE, "* Abbruch");
+    } else {
+      setWidgetLine(content, 1, ILI9341_CYAN, "Wird abgebrochen...");
+    }
+  } else if (selectedSlot != -1) {
+    setWidgetLine(content, 0, ILI9341_WHITE, "Fach: %d", selectedSlot + 1);
+    if (slotLocked[selectedSlot]) {
+      setWidgetLine(content, 1, ILI9341_RED, "Gesperrt");
+    } else if (!slotAvailable[selectedSlot]) {
+      setWidgetLine(content, 1, ILI9341_RED, "Leer");
+    } else {
+      setWidgetLine(content, 1, ILI9341_WHITE, "Preis: %.2f EUR", slotPrices[selectedSlot]);
+      if (credit >= slotPrices[selectedSlot]) {
+        setWidgetLine(content, 2, ILI9341_GREEN, "# Kaufen");
+      } else if (cashlessAvailable()) {
+        setWidgetLine(content, 2, ILI9341_YELLOW, "# Mit Karte zahlen");
+      } else {
+        setWidgetLine(content, 2, ILI9341_RED, "Guthaben?");
+      }
+    }
+  } else if (keypadInputBuffer.length() > 0) {
+    setWidgetLine(content, 0, ILI9341_WHITE, "Eingabe: %s", keypadInputBuffer.c_str());
+  } else if (dispenseQueueBusy()) {
+    char slots[24] = "";
+    size_t length = 0;
+    int waiting = 0;
+    for (int i = 0; i < dispenseCount; i++) {
+      const DispenseJob& job = dispenseJobAt(i);
+      if (job.stage == DispenseStage::WAITING) waiting++;
+      if (job.stage != DispenseStage::OPEN && job.stage != DispenseStage::RELAY_PENDING) continue;
+      if (length < sizeof(slots) - 5) length += snprintf(slots + length, sizeof(slots) - length, "%s%d", length > 0 ? ", " : "", job.slot + 1);
+    }
+    setWidgetLine(content, 0, ILI9341_CYAN, "Fach %s", slots);
+    setWidgetLine(content, 1, ILI9341_CYAN, "wird geoeffnet...");
+    if (waiting > 0) setWidgetLine(content, 2, ILI9341_WHITE, "Warteschlange: %d", waiting);
+  } else { // Idle screen
+    setWidgetLine(content, 0, ILI9341_WHITE, "Waehle Fach (1-%d)", activeSlots);
+    setWidgetLine(content, 1, ILI9341_WHITE, "oder Geld einwerfen.");
+  }
+
+  // --- Slogan (größere Schrift) ---
+  setWidgetLine(frame.widgets[DISPLAY_REGION_SLOGAN], 0, ILI9341_WHITE, "%s", displaySlogan.c_str());
+
+  // --- Footer-Text (kleinere Schrift) ---
+  setWidgetLine(frame.widgets[DISPLAY_REGION_FOOTER], 0, ILI9341_YELLOW, "%s", displayFooter.c_str());
+
+  postDisplayFrame(frame);
+}
+
+/**
+ * @brief Processes keypad input, updates buffer, and handles '#' and '*' keys.
+ */
+void processKeypad() {
+  if (!keypadScanning) return; // Idle: rows are HIGH, keypadWakeISR() restarts scanning
+
+  char key = manualGetKeyState();
+  if (key == 0) {
+    // Back to idle once no key is held and the release has been registered
+    if (lastPhysicallyPressedKey == 0) stopKeypadScanning();
+    return; // No new key press
+  }
+
+  playKeyPressBeep();
+  LOG_DEBUG("Keypad: Processed Key: '%c'", key);
+  lastUserInteractionTime = millis();
+  currentSystemState = CurrentSystemState::USER_INTERACTION;
+
+  // During a card payment only '*' (cancel) is accepted
+  if (cashlessSession.state != CashlessState::IDLE) {
+    if (key == '*') cancelCashlessSession();
+    displayNeedsUpdate = true;
+    return;
+  }
+
+  if (isdigit(key)) {
+    lastKeypadInputTime = millis();
+
+    // Slot numbers have as many digits as the highest active slot
+    if (keypadInputBuffer.length() >= slotNumberDigits()) {
+      keypadInputBuffer = ""; // Reset buffer if it's already full
+    }
+    keypadInputBuffer += key;
+    LOG_DEBUG("Keypad: Buffer updated to: %s", keypadInputBuffer.c_str());
+    processKeypadSelection();
+
+  } else if (key == '#') { // Confirm selection or purchase
+    if (keypadInputBuffer.length() > 0) {
+      LOG_DEBUG("Keypad: '#' pressed. Finalizing selection from buffer: %s", keypadInputBuffer.c_str());
+      processKeypadSelection();
+    }
+     
+    if (selectedSlot != -1) {
+      if (slotLocked[selectedSlot]) {
+        displayErrorMessage("Fach " + String(selectedSlot + 1), "gesperrt!");
+      } else if (!slotAvailable[selectedSlot]) {
+        displayErrorMessage("Fach " + String(selectedSlot + 1), "ist leer!");
+      } else if (credit >= slotPrices[selectedSlot]) {
+        LOG_INFO("Purchase attempt: Slot %d, Credit: %.2f EUR, Price: %.2f EUR.", selectedSlot + 1, credit, slotPrices[selectedSlot]);
+        scheduleDispense(selectedSlot);
+      } else if (cashlessAvailable()) {
+        startCashlessSession(selectedSlot);
+      } else {
+        displayErrorMessage("Guthaben", "zu gering!");
+      }
+    } else {
+      displayErrorMessage("Kein Fach", "gewaehlt!");
+    }
+    keypadInputBuffer = ""; // Clear buffer after '#'
+   
+} else if (key == '*') { // Cancel/reset
+    LOG_DEBUG("Keypad: '*' pressed. Resetting selection.");
+    resetDisplayToDefault();
+}
+  displayNeedsUpdate = true;
+}
+
+/**
+ * @brief Number of digits of the highest active slot number.
+ */
+int slotNumberDigits() {
+  int digits = 1;
+  for (int n = activeSlots; n >= 10; n /= 10) digits++;
+  return digits;
+}
+
+/**
+ * @brief Processes the current keypad input buffer to select a slot.
+ */
+void processKeypadSelection() {
+  if (keypadInputBuffer.isEmpty()) return;
+
+  int slotNum = keypadInputBuffer.toInt();
+  LOG_DEBUG("processKeypadSelection: Buffer '%s', toInt: %d", keypadInputBuffer.c_str(), slotNum);
+
+  if (slotNum >= 1 && slotNum <= activeSlots) {
+    selectedSlot = slotNum - 1;
+    LOG_DEBUG("Keypad: Slot %d selected from buffer.", selectedSlot + 1);
+    slotSelectedTime = millis();
+    currentSystemState = CurrentSystemState::USER_INTERACTION;
+
+    // Final once no further digit can give a valid slot (all digits typed, or e.g. "5" of 1-40)
+    bool isFinal = (int)keypadInputBuffer.length() >= slotNumberDigits() || slotNum * 10 > activeSlots;
+     
+    if (isFinal) {
+      LOG_DEBUG("Keypad: Selection '%s' is final. Clearing buffer.", keypadInputBuffer.c_str());
+      keypadInputBuffer = "";
+    } else {
+      LOG_DEBUG("Keypad: Waiting for second digit or '#' to confirm.");
+    }
+
+  } else {
+    // If all digits are typed and the input is still invalid, show an error.
+    if ((int)keypadInputBuffer.length() >= slotNumberDigits()) {
+      displayErrorMessage("Fach " + keypadInputBuffer, "ungueltig!");
+      selectedSlot = -1;
+      keypadInputBuffer = "";
+    }
+  }
+  displayNeedsUpdate = true;
+}
+
+/**
+ * @brief Writes a 16-bit register pair (port 0, then port 1) of an expander in one transaction.
+ * @return The Wire error code, 0 on success.
+ */
+uint8_t writeExpanderRegisters(uint8_t address, uint8_t reg, uint16_t value) {
+  Wire.beginTransmission(address);
+  Wire.write(reg);
+  Wire.write((uint8_t)(value & 0xFF)); // Port 0
+  Wire.write((uint8_t)(value >> 8));   // Port 1 (the chip increments to reg + 1)
+  return Wire.endTransmission();
+}
+
+/**
+ * @brief Writes the last requested outputs of an expander, then makes its relay pins outputs
+ *        (door sensor pins stay inputs). Output latches are set while the pins may still be
+ *        inputs, so no relay clicks.
+ * @return The Wire error code, 0 on success.
+ */
+uint8_t configureRelayExpander(int expander) {
+  uint8_t address = RELAY_I2C_ADDRESS + expander;
+  uint8_t error = writeExpanderRegisters(address, RELAY_REG_OUTPUT, i2cExpanderOutputs[expander]);
+  if (error == 0) error = writeExpanderRegisters(address, RELAY_REG_CONFIG, i2cExpanderInputs[expander]);
+  return error;
+}
+
+/**
+ * @brief Finds the relay expanders at consecutive addresses and switches all relays off.
+ *        Runs in i2cTask() before it serves requests.
+ */
+void initRelayExpanders() {
+  relayExpanderCount = 0;
+  expanderDirtyMask = 0;
+  // Expanders are addressed without gaps
+  while (relayExpanderCount < RELAY_MAX_EXPANDERS && probeRelayExpander(relayExpanderCount, RELAY_PROBE_ATTEMPTS)) {
+    addRelayExpander();
+  }
+  int count = relayExpanderCount;
+  if (count == 0) {
+    LOG_ERROR("No relay expander found at 0x%02X, probing again with the health check.", RELAY_I2C_ADDRESS);
+  } else {
+    LOG_INFO("Relay expanders: %d at 0x%02X-0x%02X (%d slots).", count, RELAY_I2C_ADDRESS,
+             RELAY_I2C_ADDRESS + count - 1, relaySlotCount());
+  }
+}
+
+/**
+ * @brief Checks whether the expander at RELAY_I2C_ADDRESS + expander answers.
+ * @param attempts Probes before giving up, RELAY_PROBE_RETRY_MS apart.
+ */
+bool probeRelayExpander(int expander, int attempts) {
+  for (int attempt = 1;; attempt++) {
+    Wire.beginTransmission(RELAY_I2C_ADDRESS + expander);
+    if (Wire.endTransmission() == 0) return true;
+    if (attempt >= attempts) return false;
+    vTaskDelay(pdMS_TO_TICKS(RELAY_PROBE_RETRY_MS));
+  }
+}
+
+/**
+ * @brief Switches all relays of the next expander off and counts it. The count grows only after
+ *        the configuration, so the vending task never queues writes for an unconfigured chip.
+ */
+void addRelayExpander() {
+  int i = relayExpanderCount;
+  i2cExpanderOutputs[i] = 0x0000;
+  i2cExpanderInputs[i] = 0x0000; // Door sensor pins follow with SET_INPUTS
+  uint8_t error = configureRelayExpander(i);
+  if (error != 0) LOG_ERROR("Relay expander 0x%02X: configuration failed. Code: %u", RELAY_I2C_ADDRESS + i, error);
+  relayExpanderCount = i + 1;
+}
+
+/**
+ * @brief Starts Wire on the relay bus pins with clock and timeout.
+ */
+void beginI2cBus() {
+  Wire.begin(I2C_SDA_PIN, I2C_SCL_PIN, I2C_CLOCK_HZ);
+  Wire.setTimeOut(I2C_TIMEOUT_MS);
+}
+
+/**
+ * @brief Frees a bus held by a slave stuck in mid-byte: clocks SCL until SDA is released
+ *        (at most 9 clocks), sends a STOP, restarts Wire and configures every expander again
+ *        (it may have been reset by the glitch that hung the bus).
+ */
+void recoverI2cBus() {
+  i2cRecoveries++;
+  Wire.end();
+  pinMode(I2C_SDA_PIN, INPUT_PULLUP);
+  pinMode(I2C_SCL_PIN, OUTPUT_OPEN_DRAIN);
+  digitalWrite(I2C_SCL_PIN, HIGH);
+  delayMicroseconds(10);
+  int clocks = 0;
+  while (clocks < 9 && digitalRead(I2C_SDA_PIN) == LOW) {
+    digitalWrite(I2C_SCL_PIN, LOW);
+    delayMicroseconds(10); // Half a clock at 50 kHz
+    digitalWrite(I2C_SCL_PIN, HIGH);
+    delayMicroseconds(10);
+    clocks++;
+  }
+  bool released = digitalRead(I2C_SDA_PIN) == HIGH;
+
+  // STOP: SDA rises while SCL is high
+  pinMode(I2C_SDA_PIN, OUTPUT_OPEN_DRAIN);
+  digitalWrite(I2C_SDA_PIN, LOW);
+  delayMicroseconds(10);
+  digitalWrite(I2C_SCL_PIN, HIGH);
+  delayMicroseconds(10);
+  digitalWrite(I2C_SDA_PIN, HIGH);
+  delayMicroseconds(10);
+
+  beginI2cBus();
+  int expanders = max(relayExpanderCount.load(), 1);
+  int configured = 0;
+  for (int i = 0; i < expanders; i++) {
+    if (configureRelayExpander(i) == 0) configured++;
+  }
+  LOG_WARN("I2C bus recovery: %d clocks, SDA %s, %d/%d expanders configured.",
+           clocks, released ? "released" : "still low", configured, expanders);
+}
+
+/**
+ * @brief Reads a 16-bit register pair (port 0, then port 1) of an expander.
+ * @return The Wire error code, 0 on success (4 if the chip sent fewer than two bytes).
+ */
+uint8_t readExpanderRegisters(uint8_t address, uint8_t reg, uint16_t& value) {
+  Wire.beginTransmission(address);
+  Wire.write(reg);
+  uint8_t error = Wire.endTransmission(false); // Repeated start
+  if (error != 0) return error;
+  if (Wire.requestFrom(address, (uint8_t)2) != 2) return 4;
+  uint8_t port0 = Wire.read();
+  uint8_t port1 = Wire.read();
+  value = port0 | (port1 << 8);
+  return 0;
+}
+
+/**
+ * @brief Reads back outputs and configuration of every expander and configures those that lost
+ *        them again (after a brown-out the chip resets to all inputs).
+ * @param failedExpander Set to the expander that did not answer.
+ * @return The Wire error code, 0 on success.
+ */
+uint8_t checkRelayExpanderHealth(uint8_t& failedExpander) {
+  int expanders = max(relayExpanderCount.load(), 1);
+  for (int i = 0; i < expanders; i++) {
+    uint8_t address = RELAY_I2C_ADDRESS + i;
+    uint16_t outputs = 0, config = 0;
+    uint8_t error = readExpanderRegisters(address, RELAY_REG_OUTPUT, outputs);
+    if (error == 0) error = readExpanderRegisters(address, RELAY_REG_CONFIG, config);
+    if (error == 0 && (config != i2cExpanderInputs[i] || outputs != i2cExpanderOutputs[i])) {
+      relayBrownouts++;
+      LOG_WARN("Relay expander 0x%02X lost its configuration (Config: 0x%04X, Outputs: 0x%04X, expected 0x%04X). Re-applying.",
+               address, config, outputs, i2cExpanderOutputs[i]);
+      error = configureRelayExpander(i);
+    }
+    if (error != 0) {
+      failedExpander = i;
+      return error;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief Writes both output ports of an expander and verifies the pin levels through the input
+ *        registers. On a mismatch the configuration is applied again and read back once more.
+ * @param mismatch Set to the pins that still differ from the written value.
+ * @return The Wire error code, I2C_ERROR_READBACK if the pins did not follow, 0 on success.
+ */
+uint8_t writeRelayOutputsVerified(uint8_t expander, uint16_t value, uint16_t& mismatch) {
+  uint8_t address = RELAY_I2C_ADDRESS + expander;
+  mismatch = 0;
+  uint8_t error = writeExpanderRegisters(address, RELAY_REG_OUTPUT, value);
+  uint16_t outputMask = ~i2cExpanderInputs[expander]; // Door sensor pins are not driven
+  uint16_t pins = 0;
+  if (error == 0) error = readExpanderRegisters(address, RELAY_REG_INPUT, pins);
+  if (error != 0 || ((pins ^ value) & outputMask) == 0) return error;
+
+  LOG_WARN("Relay expander 0x%02X: Pins 0x%04X after writing 0x%04X. Re-applying.", address, pins, value);
+  error = configureRelayExpander(expander);
+  if (error == 0) error = readExpanderRegisters(address, RELAY_REG_INPUT, pins);
+  if (error != 0) return error;
+  mismatch = (pins ^ value) & outputMask;
+  return mismatch ? I2C_ERROR_READBACK : 0;
+}
+
+/**
+ * @brief One attempt at an I2C request.
+ * @param result Receives the expander that failed (HEALTH_CHECK) and the read-back mismatch.
+ * @return The Wire error code (or I2C_ERROR_READBACK), 0 on success.
+ */
+uint8_t runI2cRequest(const I2cRequest& request, I2cResult& result) {
+  uint8_t address = RELAY_I2C_ADDRESS + request.expander;
+  switch (request.op) {
+    case I2cOp::WRITE_OUTPUTS:
+      return writeRelayOutputsVerified(request.expander, request.value, result.mismatch);
+    case I2cOp::READ_INPUTS:
+      return readExpanderRegisters(address, RELAY_REG_INPUT, result.pins);
+    case I2cOp::SET_INPUTS:
+      return writeExpanderRegisters(address, RELAY_REG_CONFIG, request.value);
+    default:
+      return checkRelayExpanderHealth(result.expander);
+  }
+}
+
+/**
+ * @brief Log name of a request type.
+ */
+const char* i2cOpName(I2cOp op) {
+  switch (op) {
+    case I2cOp::WRITE_OUTPUTS: return "Write to";
+    case I2cOp::READ_INPUTS: return "Input read of";
+    case I2cOp::SET_INPUTS: return "Input setup of";
+    default: return "Health check of";
+  }
+}
+
+/**
+ * @brief Alerts about relay outputs that do not follow their register (defective driver or relay).
+ */
+void reportRelayReadbackError(uint8_t expander, uint16_t mismatch, uint16_t value) {
+  relayReadbackErrors++;
+  char slots[64] = "";
+  size_t length = 0;
+  for (int bit = 0; bit < RELAYS_PER_EXPANDER && length < sizeof(slots) - 6; bit++) {
+    if (!(mismatch & (1U << bit))) continue;
+    length += snprintf(slots + length, sizeof(slots) - length, "%s%d", length > 0 ? ", " : "",
+                       expander * RELAYS_PER_EXPANDER + bit + 1);
+  }
+  LOG_ERROR("Relay expander 0x%02X: Outputs do not follow (Pins differ: 0x%04X, expected 0x%04X). Slots: %s",
+            RELAY_I2C_ADDRESS + expander, mismatch, value, slots);
+  sendTelegramMessage(String("⚠️ RELAIS FEHLER: Ausgang schaltet nicht, Fach ") + slots + ". Bitte prüfen.");
+}
+
+/**
+ * @brief Updates the cached relay board state after a request; alerts on changes.
+ */
+void setRelayBoardOnline(bool online) {
+  if (online) relayBoardLastSeen = millis();
+  if (relayBoardOnline.exchange(online) == online) return;
+  if (online) {
+    relayBoardOnlineSince = millis();
+    LOG_INFO("Relay board online.");
+    sendTelegramMessage("✅ Relaisboard wieder erreichbar.");
+  } else {
+    LOG_ERROR("Relay board offline. Sales are blocked.");
+    sendTelegramMessage("⚠️ RELAISBOARD OFFLINE: Verkäufe sind gesperrt.");
+  }
+}
+
+/**
+ * @brief Executes a request with retry, backoff and bus recovery.
+ *        While the board is offline, the health check gives up after one recovery and stays quiet.
+ */
+I2cResult executeI2cRequest(const I2cRequest& request) {
+  bool quiet = request.op == I2cOp::HEALTH_CHECK && !relayBoardOnline;
+  int maxAttempts = quiet ? I2C_RECOVERY_AFTER + 1 : I2C_MAX_ATTEMPTS;
+  I2cResult result = { request.tag, request.op, request.expander, 0, 0, 0, 0 };
+  for (;;) {
+    result.attempts++;
+    result.error = runI2cRequest(request, result);
+    result.doneAt = millis();
+    if (result.error == 0 || result.attempts >= maxAttempts) break;
+    i2cRetries++;
+    if (!quiet) {
+      LOG_WARN("I2C: %s 0x%02X failed (Code: %u), attempt %u of %d.", i2cOpName(request.op),
+               RELAY_I2C_ADDRESS + result.expander, result.error, result.attempts, maxAttempts);
+    }
+    // A read-back mismatch is no bus fault: the bus answered, the pins did not follow
+    if (result.attempts >= I2C_RECOVERY_AFTER && result.error != I2C_ERROR_READBACK) recoverI2cBus();
+    vTaskDelay(pdMS_TO_TICKS(I2C_RETRY_BASE_MS << (result.attempts - 1)));
+  }
+  if (result.error == I2C_ERROR_READBACK) {
+    reportRelayReadbackError(result.expander, result.mismatch, request.value);
+  } else if (result.error != 0) {
+    i2cFailures++;
+    if (!quiet) {
+      LOG_ERROR("I2C failed for relay expander 0x%02X after %u attempts. Code: %u",
+                RELAY_I2C_ADDRESS + result.expander, result.attempts, result.error);
+    }
+  } else if (result.attempts > 1) {
+    LOG_INFO("I2C: Relay expander 0x%02X answered on attempt %u.", RELAY_I2C_ADDRESS + result.expander, result.attempts);
+  }
+  return result;
+}
+
+/**
+ * @brief Owns the I2C bus: initializes the relay expanders, then executes queued requests and
+ *        hands each outcome to the request's reply queue. Runs the health check in between.
+ */
+void i2cTask(void* parameter) {
+  initRelayExpanders();
+  uint8_t failedExpander = 0;
+  relayBoardOnline = relayExpanderCount > 0 && checkRelayExpanderHealth(failedExpander) == 0;
+  relayBoardOnlineSince = millis();
+  relayBoardLastSeen = millis();
+  xSemaphoreGive(i2cReady);
+
+  unsigned long nextHealthCheck = millis() + RELAY_HEALTH_INTERVAL_MS;
+  for (;;) {
+    long wait = (long)(nextHealthCheck - millis());
+    I2cRequest request;
+    if (xQueueReceive(i2cRequestQueue, &request, wait > 0 ? pdMS_TO_TICKS(wait) : 0) != pdTRUE) {
+      nextHealthCheck = millis() + RELAY_HEALTH_INTERVAL_MS;
+      int count = relayExpanderCount;
+      if (count < RELAY_MAX_EXPANDERS && probeRelayExpander(count, 1)) {
+        addRelayExpander();
+        LOG_INFO("Relay expander 0x%02X found (%d slots).", RELAY_I2C_ADDRESS + count, relaySlotCount());
+        notifyVendingTask(VENDING_EVENT_RELAY); // Door sensor pins on it are set by the vending task
+      }
+      if (relayExpanderCount == 0) continue; // No relay board answering yet
+      request = { I2cOp::HEALTH_CHECK, 0, 0, 0, nullptr };
+    }
+    // Recovery and read-back re-apply the shadow while the write runs. A write that failed is
+    // rolled back, so the health check restores the last confirmed pins instead of forcing an
+    // output (e.g. a relay ON) the vending task has already given up on.
+    uint16_t previousOutputs = i2cExpanderOutputs[request.expander];
+    if (request.op == I2cOp::WRITE_OUTPUTS) i2cExpanderOutputs[request.expander] = request.value;
+    if (request.op == I2cOp::SET_INPUTS) i2cExpanderInputs[request.expander] = request.value;
+
+    I2cResult result = executeI2cRequest(request);
+    if (request.op == I2cOp::WRITE_OUTPUTS && result.error != 0) {
+      i2cExpanderOutputs[request.expander] = previousOutputs;
+    }
+    setRelayBoardOnline((result.error == 0 || result.error == I2C_ERROR_READBACK) && relayExpanderCount > 0);
+
+    if (request.replyQueue == nullptr) continue;
+    if (xQueueSend(request.replyQueue, &result, pdMS_TO_TICKS(100)) != pdTRUE) {
+      LOG_WARN("I2C: Result for tag %u dropped (reply queue full).", (unsigned)request.tag);
+    } else if (request.replyQueue == relayResultQueue) {
+      notifyVendingTask(VENDING_EVENT_RELAY);
+    }
+  }
+}
+
+/**
+ * @brief Starts the I2C bus and its task and waits until the relay expanders are initialized.
+ */
+void initI2cBus() {
+  beginI2cBus();
+  LOG_INFO("I2C clock set to %d kHz.", I2C_CLOCK_HZ / 1000);
+  i2cRequestQueue = xQueueCreate(I2C_QUEUE_LENGTH, sizeof(I2cRequest));
+  relayResultQueue = xQueueCreate(I2C_QUEUE_LENGTH, sizeof(I2cResult));
+  i2cReady = xSemaphoreCreateBinary();
+  if (i2cRequestQueue == nullptr || relayResultQueue == nullptr || i2cReady == nullptr ||
+      xTaskCreatePinnedToCore(i2cTask, "i2c", I2C_TASK_STACK_SIZE, nullptr, I2C_TASK_PRIORITY, &i2cTaskHandle, I2C_TASK_CORE) != pdPASS) {
+    LOG_ERROR("Could not start I2C task. Relays unavailable.");
+    i2cRequestQueue = nullptr;
+    return;
+  }
+  if (xSemaphoreTake(i2cReady, pdMS_TO_TICKS(I2C_READY_TIMEOUT_MS)) != pdTRUE) {
+    LOG_ERROR("I2C task: Relay expander initialization did not finish in time.");
+  }
+}
+
+/**
+ * @brief Number of slots that have a relay output.
+ */
+int relaySlotCount() {
+  return relayExpanderCount * RELAYS_PER_EXPANDER;
+}
+
+/**
+ * @brief Changes a relay in the shadow register only; commitRelayOutputs() writes it.
+ * @return False if the slot has no relay output.
+ */
+bool setSlotRelay(int slot, bool activate) {
+  if (slot < 0 || slot >= relaySlotCount()) {
+    LOG_ERROR("No relay output for slot %d.", slot + 1);
+    return false;
+  }
+  int expander = slot / RELAYS_PER_EXPANDER;
+  uint16_t bit = 1U << (slot % RELAYS_PER_EXPANDER);
+  uint16_t state = activate ? (expanderOutputStates[expander] | bit) : (expanderOutputStates[expander] & ~bit);
+  if (state != expanderOutputStates[expander]) {
+    expanderOutputStates[expander] = state;
+    expanderDirtyMask |= 1U << expander;
+  }
+  return true;
+}
+
+/**
+ * @brief Queues a write for every expander whose shadow register changed, one I2C transaction
+ *        per chip. Results arrive in relayResultQueue with the given tag.
+ * @return False if the I2C queue was full; the expanders not queued stay dirty for the next commit.
+ */
+bool commitRelayOutputs(uint32_t tag) {
+  if (i2cRequestQueue == nullptr) return false;
+  for (int i = 0; i < relayExpanderCount; i++) {
+    if (!(expanderDirtyMask & (1U << i))) continue;
+    I2cRequest request = { I2cOp::WRITE_OUTPUTS, (uint8_t)i, expanderOutputStates[i], tag, relayResultQueue };
+    if (xQueueSend(i2cRequestQueue, &request, 0) != pdTRUE) {
+      LOG_ERROR("I2C queue full, relay expander 0x%02X not written.", RELAY_I2C_ADDRESS + i);
+      return false;
+    }
+    expanderDirtyMask &= ~(1U << i);
+  }
+  return true;
+}
+
+/**
+ * @brief Switches a relay for a specific slot. The expander is always written, so exactly one
+ *        I2cResult with the tag and the slot's expander follows.
+ * @param slot The slot index (0 to relaySlotCount() - 1).
+ * @param activate True to activate the relay, false to deactivate.
+ * @param tag Returned in the result; 0 for writes nobody waits for.
+ * @return True if the write was queued.
+ */
+bool controlSlotRelay(int slot, bool activate, uint32_t tag) {
+  if (!setSlotRelay(slot, activate)) return false;
+  expanderDirtyMask |= 1U << (slot / RELAYS_PER_EXPANDER);
+  if (!commitRelayOutputs(tag)) return false;
+  LOG_DEBUG("Relay for slot %d %s command queued.", slot + 1, activate ? "ON" : "OFF");
+  return true;
+}
+
+/**
+ * @brief Hands the I2C results of relay writes to the dispense jobs waiting for them.
+ *        Failures are already logged by i2cTask().
+ */
+void processRelayResults() {
+  if (relayResultQueue == nullptr) return;
+  if (doorSensorExpanders != relayExpanderCount) applyDoorSensors(); // Expander found after boot
+  I2cResult result;
+  while (xQueueReceive(relayResultQueue, &result, 0) == pdTRUE) {
+    if (result.tag == 0) continue; // Write nobody waits for
+    for (int i = 0; i < dispenseCount; i++) {
+      DispenseJob& job = dispenseJobAt(i);
+      if (result.op == I2cOp::READ_INPUTS) { // Door sensor on an expander pin
+        if (result.tag != job.doorTag) continue;
+        if (job.stage != DispenseStage::OPEN || !job.doorReadPending) break;
+        job.doorReadPending = false;
+        bool levelHigh = result.pins & (1U << (job.doorSensor % RELAYS_PER_EXPANDER));
+        if (result.error == 0 && doorLevelIsOpen(levelHigh)) finishDoorOpened(job, result.doneAt);
+        break;
+      }
+      if (result.tag != job.relayTag) continue;
+      if (job.stage != DispenseStage::RELAY_PENDING || result.expander != job.slot / RELAYS_PER_EXPANDER) continue;
+      if (result.error != 0) {
+        LOG_ERROR("processDispenseJobs: Activating relay for slot %d failed", job.slot + 1);
+        abortDispenseJob(job);
+      } else {
+        startDispenseOpen(job);
+      }
+      break;
+    }
+  }
+}
+
+/**
+ * @brief Job at a position of the dispense ring, 0 = oldest.
+ */
+DispenseJob& dispenseJobAt(int index) {
+  return dispenseJobs[(dispenseHead + index) % DISPENSE_QUEUE_LENGTH];
+}
+
+/**
+ * @brief True while any dispense job is waiting or running.
+ */
+bool dispenseQueueBusy() {
+  for (int i = 0; i < dispenseCount; i++) {
+    if (dispenseJobAt(i).stage != DispenseStage::DONE) return true;
+  }
+  return false;
+}
+
+/**
+ * @brief True if no further dispense job can be queued.
+ */
+bool dispenseQueueFull() {
+  return dispenseCount >= DISPENSE_QUEUE_LENGTH;
+}
+
+/**
+ * @brief Queues a dispense job for a slot and reserves its price from credit.
+ * @param slotToDispense The slot index to be dispensed.
+ * @param cashlessCents Part of the price already paid by card.
+ * @return False if the job could not be queued (nothing is reserved then).
+ */
+bool scheduleDispense(int slotToDispense, uint16_t cashlessCents) {
+  LOG_DEBUG("scheduleDispense: Called for slot %d", slotToDispense + 1);
+  if (pulseLearn.active) {
+    LOG_WARN("scheduleDispense: Learn mode active, sales are blocked.");
+    displayErrorMessage("Lernmodus", "kein Verkauf");
+    return false;
+  }
+  if (dispenseQueueFull()) {
+    LOG_WARN("scheduleDispense: Dispense queue full. New request ignored.");
+    displayErrorMessage("Bitte warten", "Ausgabe laeuft");
+    return false;
+  }
+  for (int i = 0; i < dispenseCount; i++) {
+    const DispenseJob& job = dispenseJobAt(i);
+    if (job.slot == slotToDispense && job.stage != DispenseStage::DONE) {
+      LOG_WARN("scheduleDispense: Slot %d is already queued.", slotToDispense + 1);
+      displayErrorMessage("Fach " + String(slotToDispense + 1), "bereits gekauft");
+      return false;
+    }
+  }
+  float reserve = slotPrices[slotToDispense] - cashlessCents / 100.0f;
+  if (reserve < 0) reserve = 0;
+  if (credit + 0.005f < reserve) {
+    LOG_WARN("scheduleDispense: Credit %.2f does not cover %.2f EUR.", credit, reserve);
+    displayErrorMessage("Guthaben", "zu gering!");
+    return false;
+  }
+  if (!checkRelayBoardOnline()) {
+    displayErrorMessage("Relais Fehler", "Board offline");
+    return false;
+  }
+
+  // Queue the job and reserve its price
+  DispenseJob& job = dispenseJobAt(dispenseCount);
+  dispenseCount++;
+  job.slot = slotToDispense;
+  job.stage = DispenseStage::WAITING;
+  job.startTime = millis();
+  job.relayTag = 0;
+  job.doorTag = 0;
+  job.cashlessCents = cashlessCents;
+  job.price = slotPrices[slotToDispense];
+  job.creditBefore = credit;
+  job.reservedCredit = reserve;
+  credit -= reserve;
+  if (credit < 0) credit = 0;
+  markCreditChanged();
+  LOG_INFO("Dispense job queued for slot %d (%d in queue). Credit left: %.2f", slotToDispense + 1, dispenseCount, credit);
+  currentSystemState = CurrentSystemState::USER_INTERACTION;
+
+  // The next item can be chosen right away
+  selectedSlot = -1;
+  keypadInputBuffer = "";
 
-  switch(currentSystemState) {
-    case CurrentSystemState::ERROR_DISPLAY:
-      // This case is handled by displayErrorMessage(), no action needed here.
-      break;
+  // Display message to user
+  static DisplayFrame frame;
+  beginDisplayOverlay(frame);
+  addOverlayItem(frame, &Poppins_Regular10pt7b, ILI9341_CYAN, 10, 100, "Fach %d", slotToDispense + 1);
+  addOverlayItem(frame, &Poppins_Regular10pt7b, ILI9341_CYAN, 10, 130, "wird vorbereitet...");
+  postDisplayFrame(frame);
+  displayNeedsUpdate = true;
+  return true;
+}
 
-    default: // Covers IDLE and USER_INTERACTION
-      if (dispenseJob.active) {
-        tft.setTextColor(ILI9341_CYAN);
-        tft.setCursor(10, y_dynamic_start);
-        tft.print("Fach "); tft.print(dispenseJob.slot + 1);
-        tft.setCursor(10, y_dynamic_start + line_spacing);
-        tft.print("wird geoeffnet...");
-      } else if (selectedSlot != -1) {
-        tft.setTextColor(ILI9341_WHITE);
-        tft.setCursor(10, y_dynamic_start);
-        tft.print("Fach: "); tft.println(selectedSlot + 1);
-        tft.setCursor(10, y_dynamic_start + line_spacing);
-        if (slotLocked[selectedSlot]) {
-          tft.setTextColor(ILI9341_RED); tft.println("Gesperrt");
-        } else if (!slotAvailable[selectedSlot]) {
-          tft.setTextColor(ILI9341_RED); tft.println("Leer");
-        } else {
-          tft.setTextColor(ILI9341_WHITE);
-          sprintf(buffer, "Preis: %.2f EUR", slotPrices[selectedSlot]);
-          tft.println(buffer);
-          tft.setCursor(10, y_dynamic_start + (line_spacing * 2));
-          if (credit >= slotPrices[selectedSlot]) {
-            tft.setTextColor(ILI9341_GREEN); tft.println("# Kaufen");
-          } else {
-            tft.setTextColor(ILI9341_RED); tft.println("Guthaben?");
-          }
-        }
-      } else if (keypadInputBuffer.length() > 0) {
-        tft.setTextColor(ILI9341_WHITE);
-        tft.setCursor(10, y_dynamic_start);
-        tft.print("Eingabe: "); tft.println(keypadInputBuffer);
-      } else { // Idle screen
-        tft.setTextColor(ILI9341_WHITE);
-        tft.setCursor(10, y_dynamic_start);
-        tft.println("Waehle Fach (1-" + String(activeSlots) + ")");
-        tft.setCursor(10, y_dynamic_start + line_spacing);
-        tft.println("oder Geld einwerfen.");
-      }
-      break;
+/**
+ * @brief Ends a dispense job whose relay could not be switched on. Nothing is charged:
+ *        the reserved credit and a card payment go (back) to credit. The relay bit is cleared
+ *        and an OFF write queued in case the ON write still went through (or goes through later).
+ */
+void abortDispenseJob(DispenseJob& job) {
+  controlSlotRelay(job.slot, false);
+  float refund = job.reservedCredit + job.cashlessCents / 100.0f;
+  credit += refund;
+  markCreditChanged();
+  if (job.cashlessCents > 0) {
+    // The card has been charged: keep the money as credit for another slot
+    LOG_WARN("Card payment of %.2f EUR added to credit.", job.cashlessCents / 100.0);
   }
-  
+  LOG_INFO("Dispense for slot %d aborted, %.2f EUR back to credit.", job.slot + 1, refund);
+  job.stage = DispenseStage::DONE;
+  displayErrorMessage("Relais Fehler", "Kauf abgebrochen");
+  displayNeedsUpdate = true;
+}
 
-// --- Slogan zeichnen (größere Schrift) ---
-if (displaySlogan.length() > 0) {
-  tft.setFont(&Poppins_Regular10pt7b); // Größere Schrift für den Slogan
-  tft.setTextColor(ILI9341_WHITE);
-  tft.getTextBounds(displaySlogan, 0, 0, &x1, &y1, &w, &h);
-  // Positionierung angepasst für größere Schrift
-  tft.setCursor((tft.width() - w) / 2, tft.height() - h - 25); 
-  tft.println(displaySlogan);
+/**
+ * @brief The relay of a dispense job is confirmed on: starts its timer and door watch. Without a
+ *        door sensor the sale is booked right away, otherwise when the door opens (or not).
+ */
+void startDispenseOpen(DispenseJob& job) {
+  unsigned long now = millis();
+  job.stage = DispenseStage::OPEN;
+  job.startTime = now; // Timer for the dispense duration
+  job.doorSensor = doorSensorUsable(doorSensors[job.slot]) ? doorSensors[job.slot] : DOOR_SENSOR_NONE;
+  job.doorReadPending = false;
+  job.lastDoorPoll = now - DOOR_POLL_INTERVAL_MS; // First poll right away
+  if (job.doorSensor == DOOR_SENSOR_NONE) {
+    completeDispensePurchase(job);
+  } else {
+    pollDoorSensor(job, now);
+  }
+  displayNeedsUpdate = true;
 }
 
-// --- Footer-Text zeichnen (kleinere Schrift) ---
-tft.setFont(&Poppins_Regular7pt7b); // Kleinere Schrift für den Footer
-tft.setTextColor(ILI9341_YELLOW);
-tft.getTextBounds(displayFooter, 0, 0, &x1, &y1, &w, &h);
-tft.setCursor((tft.width() - w) / 2, tft.height() - h - 5);
-tft.print(displayFooter);
+/**
+ * @brief True if a sensor level means "door open".
+ */
+bool doorLevelIsOpen(bool levelHigh) {
+  return levelHigh == doorOpenHigh;
 }
 
 /**
- * @brief Processes keypad input, updates buffer, and handles '#' and '*' keys.
+ * @brief Reads a GPIO door sensor directly, or queues an input read for an expander pin
+ *        (answered through processRelayResults()). At most once per DOOR_POLL_INTERVAL_MS; an
+ *        expander read without a result after DOOR_READ_TIMEOUT_MS is given up and sent again.
  */
-void processKeypad() {
-  char key = manualGetKeyState();
-  if (key == 0) return; // No new key press
+void pollDoorSensor(DispenseJob& job, unsigned long now) {
+  if (job.doorReadPending) {
+    if (now - job.lastDoorPoll < DOOR_READ_TIMEOUT_MS) return;
+    LOG_WARN("Door read for slot %d not answered, reading again.", job.slot + 1);
+    job.doorReadPending = false; // A late result no longer matches doorTag
+  }
+  if (now - job.lastDoorPoll < DOOR_POLL_INTERVAL_MS) return;
+  job.lastDoorPoll = now;
+  if (job.doorSensor & DOOR_SENSOR_GPIO) {
+    if (doorLevelIsOpen(digitalRead(job.doorSensor & ~DOOR_SENSOR_GPIO) == HIGH)) finishDoorOpened(job, now);
+    return;
+  }
+  job.doorTag = ++relayRequestCounter;
+  I2cRequest request = { I2cOp::READ_INPUTS, (uint8_t)(job.doorSensor / RELAYS_PER_EXPANDER), 0, job.doorTag, relayResultQueue };
+  if (i2cRequestQueue != nullptr && xQueueSend(i2cRequestQueue, &request, 0) == pdTRUE) job.doorReadPending = true;
+}
 
-  playKeyPressBeep();
-  logMessage(String("Keypad: Processed Key: '") + key + "'");
-  lastUserInteractionTime = millis();
+/**
+ * @brief The door of a dispense job reported open: records the latency, books the sale and
+ *        releases the relay right away.
+ * @param sampledAt When the sensor was read (GPIO poll or I2C result), not when it is processed.
+ */
+void finishDoorOpened(DispenseJob& job, unsigned long sampledAt) {
+  unsigned long latency = min(sampledAt - job.startTime, 65535UL);
+  DoorStats& stats = doorStats[job.slot];
+  if (stats.opens == 0 || latency < stats.minMs) stats.minMs = latency;
+  if (latency > stats.maxMs) stats.maxMs = latency;
+  stats.totalMs += latency;
+  if (stats.opens < UINT16_MAX) stats.opens++;
+  LOG_INFO("Door of slot %d open after %lu ms. Releasing relay.", job.slot + 1, latency);
+
+  completeDispensePurchase(job);
+  controlSlotRelay(job.slot, false);
+  job.stage = DispenseStage::DONE;
+}
+
+/**
+ * @brief The door of a dispense job never reported open: books the sale flagged for the
+ *        operator and alerts. Money is not refunded automatically, the relay write was confirmed.
+ */
+void finishDoorNotOpened(DispenseJob& job) {
+  DoorStats& stats = doorStats[job.slot];
+  if (stats.notOpened < UINT16_MAX) stats.notOpened++;
+  LOG_ERROR("Door of slot %d did not report open within %lu ms.", job.slot + 1, DISPENSE_RELAY_ON_TIME);
+  sendTelegramMessage("⚠️ FACH #" + String(job.slot + 1) + ": Tür hat nicht geöffnet (Verkauf markiert). Bitte prüfen.");
+  completeDispensePurchase(job, true);
+}
+
+/**
+ * @brief Books the sale of a dispense job.
+ * @param doorUnconfirmed The door sensor never reported open; the ledger record is flagged.
+ */
+void completeDispensePurchase(DispenseJob& job, bool doorUnconfirmed) {
+  // The price was taken from credit when the job was queued
+  recordSale(job.slot, job.price, job.creditBefore, job.creditBefore - job.reservedCredit, job.cashlessCents > 0, doorUnconfirmed);
+  slotAvailable[job.slot] = false;
+  LOG_INFO("Purchase complete for slot %d. Credit: %.2f", job.slot + 1, credit);
+
+  // Persist changes (a sale is a state transition: commit right away)
+  markSlotTableChanged();
+  commitSettingsCache();
+
+  // Send notifications
+  if (telegramNotifyOnSale) {
+      String saleMessage = "🍯 VERKAUF: Fach #" + String(job.slot + 1) + " wurde verkauft und ist jetzt leer.";
+      sendTelegramMessage(saleMessage);
+  }
+  checkOverallStockLevel();
+
+  // Play sound and update display
+  if (doorUnconfirmed) {
+    displayErrorMessage("Fach " + String(job.slot + 1), "klemmt? Bitte melden");
+    return;
+  }
+  playThankYouMelody();
+  static DisplayFrame frame;
+  beginDisplayOverlay(frame);
+  addOverlayItem(frame, &Poppins_Black14pt7b, ILI9341_GREEN, 10, 100, "Danke!");
+  addOverlayItem(frame, &Poppins_Regular10pt7b, ILI9341_GREEN, 10, 140, "Fach %d offen.", job.slot + 1);
+  postDisplayFrame(frame);
+  displayNeedsUpdate = true;
+}
+
+/**
+ * @brief Runs the dispense queue: closes doors whose time is up, gives up on relay writes that
+ *        were never answered and opens waiting jobs in order while the concurrency limit allows.
+ *        Sales are booked by processRelayResults() once the I2C task confirmed the relay.
+ */
+void processDispenseJobs() {
+  if (dispenseCount == 0) return;
+
+  unsigned long currentTime = millis();
   currentSystemState = CurrentSystemState::USER_INTERACTION;
+  bool finished = false;
+
+  int running = 0;
+  for (int i = 0; i < dispenseCount; i++) {
+    DispenseJob& job = dispenseJobAt(i);
+    if (job.stage == DispenseStage::RELAY_PENDING) {
+      if (currentTime - job.startTime >= RELAY_RESULT_TIMEOUT_MS) {
+        LOG_ERROR("processDispenseJobs: No I2C result for slot %d", job.slot + 1);
+        abortDispenseJob(job);
+        finished = true;
+        continue;
+      }
+      running++;
+    } else if (job.stage == DispenseStage::OPEN) {
+      if (currentTime - job.startTime >= DISPENSE_RELAY_ON_TIME) {
+        LOG_DEBUG("Dispense time elapsed. Deactivating relay for slot %d", job.slot + 1);
+        controlSlotRelay(job.slot, false);
+        if (job.doorSensor != DOOR_SENSOR_NONE) finishDoorNotOpened(job);
+        job.stage = DispenseStage::DONE;
+        finished = true;
+        continue;
+      }
+      if (job.doorSensor != DOOR_SENSOR_NONE) {
+        pollDoorSensor(job, currentTime);
+        if (job.stage == DispenseStage::DONE) { // Door open, relay already released
+          finished = true;
+          continue;
+        }
+      }
+      running++;
+    }
+  }
 
-  if (isdigit(key)) {
-    lastKeypadInputTime = millis();
+  // Open waiting doors in order (payment follows the relay confirmation)
+  for (int i = 0; i < dispenseCount && running < dispenseConcurrency; i++) {
+    DispenseJob& job = dispenseJobAt(i);
+    if (job.stage != DispenseStage::WAITING) continue;
+    job.relayTag = ++relayRequestCounter;
+    if (!controlSlotRelay(job.slot, true, job.relayTag)) {
+      LOG_ERROR("processDispenseJobs: Activating relay for slot %d failed", job.slot + 1);
+      abortDispenseJob(job);
+      finished = true;
+      continue;
+    }
+    job.stage = DispenseStage::RELAY_PENDING;
+    job.startTime = currentTime;
+    running++;
+  }
 
-    // Logic to handle 1 or 2-digit slot numbers
-    if (keypadInputBuffer.length() >= 2) {
-      keypadInputBuffer = ""; // Reset buffer if it's already full
+  // Drop finished jobs from the head of the ring
+  while (dispenseCount > 0 && dispenseJobAt(0).stage == DispenseStage::DONE) {
+    dispenseHead = (dispenseHead + 1) % DISPENSE_QUEUE_LENGTH;
+    dispenseCount--;
+    finished = true;
+  }
+  if (!finished) return;
+  if (currentSystemState == CurrentSystemState::ERROR_DISPLAY) {
+    displayNeedsUpdate = true; // Repainted when the error message ends
+  } else if (dispenseCount == 0 && selectedSlot == -1 && keypadInputBuffer.isEmpty()) {
+    resetDisplayToDefault(); // Basket handed out, customer not choosing another item
+  } else {
+    displayNeedsUpdate = true;
+  }
+}
+
+/**
+ * @brief Credits coin groups closed by the pulse poll timer (or learns them in learn mode).
+ */
+void processAcceptedCoin() {
+  if (coinGroupQueue == nullptr) return; // Pulse counting not running (ccTalk build)
+  PulseGroupEvent group;
+  while (xQueueReceive(coinGroupQueue, &group, 0) == pdTRUE) {
+    int pulsesToProcess = group.pulses;
+    LOG_DEBUG("Coin: Processing %d pulses.", pulsesToProcess);
+    if (pulseLearn.active && pulseLearn.acceptor == PULSE_ACCEPTOR_COIN) {
+      learnPulseGroup(group);
+      continue;
     }
-    keypadInputBuffer += key;
-    logMessage("Keypad: Buffer updated to: " + keypadInputBuffer);
-    processKeypadSelection();
 
-  } else if (key == '#') { // Confirm selection or purchase
-    if (keypadInputBuffer.length() > 0) {
-      logMessage("Keypad: '#' pressed. Finalizing selection from buffer: " + keypadInputBuffer);
-      processKeypadSelection();
+    if (pulsesToProcess > 0 && pulsesToProcess < PULSE_TABLE_SIZE) {
+      int coinValueCents = pulseValues[pulsesToProcess];
+      if (coinValueCents > 0) {
+        creditCoinCents(coinValueCents);
+        LOG_INFO("Coin accepted: %d pulses -> %.2f EUR. New credit: %.2f EUR", pulsesToProcess, coinValueCents / 100.0, credit);
+      } else {
+        LOG_WARN("Coin: %d pulses has a value of 0 (invalid pulse count).", pulsesToProcess);
+      }
+    } else {
+      LOG_WARN("Coin: Invalid pulse count rejected: %d", pulsesToProcess);
     }
-     
-    if (selectedSlot != -1) {
-      if (slotLocked[selectedSlot]) {
-        displayErrorMessage("Fach " + String(selectedSlot + 1), "gesperrt!");
-      } else if (!slotAvailable[selectedSlot]) {
-        displayErrorMessage("Fach " + String(selectedSlot + 1), "ist leer!");
-      } else if (credit >= slotPrices[selectedSlot]) {
-        logMessage("Purchase attempt: Slot " + String(selectedSlot + 1) + ", Credit: " + String(credit,2) + " EUR, Price: " + String(slotPrices[selectedSlot],2) + " EUR.");
-        scheduleDispense(selectedSlot);
+  }
+}
+
+/**
+ * @brief Credits bill groups closed by the pulse poll timer (or learns them in learn mode).
+ */
+void processBillAcceptorPulses() {
+  if (billGroupQueue == nullptr) return; // Pulse counting not running (ccTalk build)
+  uint32_t discarded = billPulsesDiscarded.exchange(0);
+  if (discarded > 0) LOG_DEBUG("Bill: Pulses ignored at startup. Count: %lu", (unsigned long)discarded);
+  uint32_t rejected = billPulsesRejected.exchange(0);
+  if (rejected > 0) LOG_DEBUG("Bill: Pulses rejected (invalid width or period). Count: %lu", (unsigned long)rejected);
+  uint32_t lost = billGroupsLost.exchange(0);
+  if (lost > 0) {
+    LOG_ERROR("Bill: %lu pulse group(s) not credited, edge stamps lost (pulse ring overflow).", (unsigned long)lost);
+    sendTelegramMessage("⚠️ BANKNOTE: Impulse gestört, " + String(lost) + " Gruppe(n) nicht gutgeschrieben. Bitte Kasse prüfen.");
+  }
+
+  PulseGroupEvent group;
+  while (xQueueReceive(billGroupQueue, &group, 0) == pdTRUE) {
+    int pulsesToProcess = group.pulses;
+    LOG_DEBUG("Bill: Processing %d pulses.", pulsesToProcess);
+    if (pulseLearn.active && pulseLearn.acceptor == PULSE_ACCEPTOR_BILL) {
+      learnPulseGroup(group);
+      continue;
+    }
+
+    if (pulsesToProcess > 0 && pulsesToProcess < PULSE_TABLE_SIZE) {
+      int billValueEuros = billValues[pulsesToProcess];
+      if (billValueEuros > 0) {
+        creditBillEuros(billValueEuros);
+        LOG_INFO("Bill accepted: %d pulses -> %d EUR. New credit: %.2f EUR", pulsesToProcess, billValueEuros, credit);
       } else {
-        displayErrorMessage("Guthaben", "zu gering!");
+        LOG_WARN("Bill: %d pulses has a value of 0.", pulsesToProcess);
       }
     } else {
-      displayErrorMessage("Kein Fach", "gewaehlt!");
+      LOG_WARN("Bill: Invalid pulse count rejected: %d", pulsesToProcess);
     }
-    keypadInputBuffer = ""; // Clear buffer after '#'
+  }
    
-} else if (key == '*') { // Cancel/reset
-    logMessage("Keypad: '*' pressed. Resetting selection.");
-    resetDisplayToDefault();
+  // Inhibit the bill acceptor while pulses are being received, re-enable when done.
+  digitalWrite(BILL_INHIBIT_PIN, billGroupOpen ? HIGH : LOW);
 }
+
+/**
+ * @brief Books an accepted coin, whatever interface reported it: credit, session totals and beep.
+ */
+void creditCoinCents(int cents) {
+  credit += (float)cents / 100.0;
+  sessionCoinCents += cents;
+  markCreditChanged();
+
   displayNeedsUpdate = true;
+  lastUserInteractionTime = millis();
+  currentSystemState = CurrentSystemState::USER_INTERACTION;
+  playToneSequence(COIN_ACCEPTED_BEEP, sizeof(COIN_ACCEPTED_BEEP) / sizeof(COIN_ACCEPTED_BEEP[0]));
 }
 
 /**
- * @brief Processes the current keypad input buffer to select a slot.
+ * @brief Books an accepted bill, whatever interface reported it: credit, session totals and beep.
  */
-void processKeypadSelection() {
-  if (keypadInputBuffer.isEmpty()) return;
-
-  int slotNum = keypadInputBuffer.toInt();
-  logMessage("processKeypadSelection: Buffer '" + keypadInputBuffer + "', toInt: " + String(slotNum));
+void creditBillEuros(int euros) {
+  credit += euros;
+  sessionBillEuros += euros;
+  markCreditChanged();
 
-  if (slotNum >= 1 && slotNum <= activeSlots) {
-    selectedSlot = slotNum - 1;
-    logMessage("Keypad: Slot " + String(selectedSlot + 1) + " selected from buffer.");
-    slotSelectedTime = millis();
-    currentSystemState = CurrentSystemState::USER_INTERACTION;
+  displayNeedsUpdate = true;
+  lastUserInteractionTime = millis();
+  currentSystemState = CurrentSystemState::USER_INTERACTION;
+  playToneSequence(BILL_ACCEPTED_BEEP, sizeof(BILL_ACCEPTED_BEEP) / sizeof(BILL_ACCEPTED_BEEP[0]));
+}
 
-    // Check if the selection can be considered final (e.g., for single-digit slots or after 2 digits)
-    bool isFinal = (keypadInputBuffer.length() == 2) || (activeSlots < 10);
-    if (keypadInputBuffer.length() == 1 && activeSlots >= 10) {
-        // If first digit is too high for a valid 2-digit number, it's final
-        if (keypadInputBuffer.toInt() > activeSlots / 10) {
-            isFinal = true;
-        }
-    }
-     
-    if (isFinal) {
-      logMessage("Keypad: Selection '" + keypadInputBuffer + "' is final. Clearing buffer.");
-      keypadInputBuffer = "";
+/**
+ * @brief Credits coins and bills reported by the ccTalk driver.
+ */
+void processCreditEvents() {
+  if (creditEventQueue == nullptr) return;
+  CreditEvent event;
+  while (xQueueReceive(creditEventQueue, &event, 0) == pdTRUE) {
+    if (event.acceptor == PULSE_ACCEPTOR_COIN) {
+      creditCoinCents(event.value);
+      LOG_INFO("Coin accepted: type %u -> %.2f EUR. New credit: %.2f EUR", event.type, event.value / 100.0, credit);
     } else {
-      logMessage("Keypad: Waiting for second digit or '#' to confirm.");
+      creditBillEuros(event.value);
+      LOG_INFO("Bill accepted: type %u -> %u EUR. New credit: %.2f EUR", event.type, event.value, credit);
+    }
+  }
+}
+
+/**
+ * @brief Converts euros to the unit of an acceptor's pulse table (cents for coins, euros for bills).
+ */
+uint16_t pulseTableUnits(int acceptor, float euros) {
+  long units = acceptor == PULSE_ACCEPTOR_COIN ? lroundf(euros * 100.0f) : lroundf(euros);
+  return (uint16_t)constrain(units, 0L, 65535L);
+}
+
+/**
+ * @brief Learn mode: stores a closed group under the denomination being learned, without
+ *        crediting it. A pulse count that already maps to another value is held back until
+ *        the operator confirms the overwrite (CONFIRM_PULSE_LEARN).
+ */
+void learnPulseGroup(const PulseGroupEvent& group) {
+  const char* name = pulseLearn.acceptor == PULSE_ACCEPTOR_COIN ? "Coin" : "Bill";
+  pulseLearn.lastActivity = millis();
+  displayNeedsUpdate = true;
+  if (group.pulses <= 0 || group.pulses >= PULSE_TABLE_SIZE) {
+    LOG_WARN("Learn: %s with %d pulses does not fit the table (max %d).", name, group.pulses, PULSE_TABLE_SIZE - 1);
+    playErrorSound();
+    return;
+  }
+  uint16_t existing = (pulseLearn.acceptor == PULSE_ACCEPTOR_COIN ? pulseValues : billValues)[group.pulses];
+  if (existing != 0 && existing != pulseLearn.value) {
+    pulseLearn.conflictPulses = group.pulses;
+    pulseLearn.conflictIntervalUs = group.maxIntervalUs;
+    LOG_WARN("Learn: %s with %d pulses is already stored as %u, not overwritten without confirmation.", name, group.pulses, existing);
+    playErrorSound();
+    return;
+  }
+  pulseLearn.conflictPulses = 0;
+  storeLearnedGroup(group.pulses, group.maxIntervalUs);
+}
+
+/**
+ * @brief Writes a learned group to the pulse table and records its timing for the suggested
+ *        grouping timeout.
+ */
+void storeLearnedGroup(int pulses, uint32_t maxIntervalUs) {
+  const char* name = pulseLearn.acceptor == PULSE_ACCEPTOR_COIN ? "Coin" : "Bill";
+  (pulseLearn.acceptor == PULSE_ACCEPTOR_COIN ? pulseValues : billValues)[pulses] = pulseLearn.value;
+  pulseLearn.lastPulses = pulses;
+  pulseLearn.samples[pulseLearn.acceptor]++;
+  if (maxIntervalUs > 0) {
+    pulseLearn.intervalSamples[pulseLearn.acceptor]++;
+    pulseLearn.maxIntervalUs[pulseLearn.acceptor] = max(pulseLearn.maxIntervalUs[pulseLearn.acceptor], maxIntervalUs);
+  }
+  savePulseTables();
+  LOG_INFO("Learn: %s with %d pulses (longest interval %lu ms) stored as %u %s.", name, pulses,
+           (unsigned long)(maxIntervalUs / 1000), pulseLearn.value, pulseLearn.acceptor == PULSE_ACCEPTOR_COIN ? "ct" : "EUR");
+  playToneSequence(COIN_ACCEPTED_BEEP, sizeof(COIN_ACCEPTED_BEEP) / sizeof(COIN_ACCEPTED_BEEP[0]));
+}
+
+/**
+ * @brief Ends learn mode (web command or LEARN_MODE_TIMEOUT_MS): payments are credited and
+ *        sales possible again. Measurements stay until the next session starts.
+ */
+void stopPulseLearn() {
+  pulseLearn.active = false;
+  pulseLearn.conflictPulses = 0;
+  displayNeedsUpdate = true;
+  LOG_INFO("Learn: Mode ended.");
+}
+
+/**
+ * @brief Tightest safe grouping timeout from the intervals measured in learn mode, rounded up
+ *        to 10 ms. Returns 0 until LEARN_MIN_INTERVAL_SAMPLES multi-pulse groups have been
+ *        learned for the acceptor: the margin is only safe over enough samples.
+ */
+unsigned long learnedGroupTimeoutMs(int acceptor) {
+  uint32_t intervalUs = pulseLearn.maxIntervalUs[acceptor];
+  if (intervalUs == 0 || pulseLearn.intervalSamples[acceptor] < LEARN_MIN_INTERVAL_SAMPLES) return 0;
+  unsigned long timeoutMs = ((uint64_t)intervalUs * LEARN_TIMEOUT_MARGIN_PERCENT / 100 + 9999) / 10000 * 10;
+  return max(timeoutMs, (unsigned long)PULSE_GAP_MIN_MS);
+}
+
+/**
+ * @brief Takes over the learned grouping timeouts and stores them like the timing settings.
+ */
+void applyLearnedTimeouts() {
+  unsigned long coinMs = learnedGroupTimeoutMs(PULSE_ACCEPTOR_COIN);
+  unsigned long billMs = learnedGroupTimeoutMs(PULSE_ACCEPTOR_BILL);
+  preferences.begin("hanimat", false);
+  if (coinMs > 0) {
+    COIN_PROCESSING_DELAY = coinMs;
+    preferences.putULong("coinDelay", coinMs);
+  }
+  if (billMs > 0) {
+    BILL_GROUP_PROCESSING_TIMEOUT_MS = billMs;
+    preferences.putULong("billGrpTout", billMs);
+  }
+  preferences.end();
+  LOG_INFO("Learn: Grouping timeouts applied (coins %lu ms, bills %lu ms, 0 = unchanged).", coinMs, billMs);
+}
+
+/**
+ * @brief Displays a centered, two-line error message on the TFT and returns right away. The
+ *        selection is cleared now; vendingTask() restores the default screen after
+ *        ERROR_DISPLAY_TIME, or earlier on the next key press.
+ * @param line1 The first (main) line of the error message.
+ * @param line2 The second (optional) line of the error message.
+ */
+void displayErrorMessage(const String &line1, const String &line2) {
+    LOG_INFO("Display Error: %s%s%s", line1.c_str(), line2.length() > 0 ? " | " : "", line2.c_str());
+    currentSystemState = CurrentSystemState::ERROR_DISPLAY;
+
+    static DisplayFrame frame;
+    beginDisplayOverlay(frame);
+    addOverlayItem(frame, &Poppins_Regular10pt7b, ILI9341_RED, -1, 100, "%s", line1.c_str());
+    if (line2.length() > 0) { // Line 2 (if present)
+        addOverlayItem(frame, &Poppins_Regular10pt7b, ILI9341_RED, -1, 130, "%s", line2.c_str());
     }
+    postDisplayFrame(frame);
+
+    playErrorSound();
+    selectedSlot = -1;
+    keypadInputBuffer = "";
+    errorDisplayUntil = millis() + ERROR_DISPLAY_TIME;
+}
+
+
+// =================================================================
+//                      WEB SERVER HANDLERS
+// =================================================================
 
+/**
+ * @brief Handles requests to the root URL ("/"). Shows login or dashboard.
+ */
+void handleRoot() {
+  lastActivityTimeWeb = millis();
+  if (!isAuthenticated) {
+    showLoginPage();
   } else {
-    // If the input is 2 digits long and still invalid, show an error.
-    if (keypadInputBuffer.length() == 2) {
-      displayErrorMessage("Fach " + keypadInputBuffer, "ungueltig!");
-      selectedSlot = -1;
-      keypadInputBuffer = "";
+    showAdminApp();
+  }
+}
+
+/**
+ * @brief Handles the login form submission.
+ */
+void handleLogin() {
+  lastActivityTimeWeb = millis();
+  if (server.hasArg("password") && server.arg("password") == savedPassword) {
+    isAuthenticated = true;
+    LOG_INFO("Web: Login successful.");
+    server.sendHeader("Location", "/", true);
+    server.send(302, "text/plain", "");
+  } else {
+    LOG_INFO("Web: Login failed.");
+    showLoginPage();
+  }
+}
+
+// --- JSON API ---
+
+/**
+ * @brief Streams a response with chunked transfer encoding through a small fixed buffer,
+ *        so a generated page or JSON document never exists as one String in RAM. Constant
+ *        fragments longer than the buffer are handed to the server straight from flash.
+ */
+class ChunkedResponseWriter {
+public:
+  explicit ChunkedResponseWriter(WebServer& webServer) : web(webServer), used(0) {}
+
+  /** @brief Sends the status line and headers. The body follows in chunks. */
+  void begin(int code, const char* contentType) {
+    web.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    web.send(code, contentType, "");
+  }
+
+  void write(const char* text) { write(text, strlen(text)); }
+
+  void write(const char* text, size_t length) {
+    if (length > sizeof(buffer) - used) {
+      flush();
+      if (length >= sizeof(buffer)) {
+        web.sendContent(text, length);
+        return;
+      }
+    }
+    memcpy(buffer + used, text, length);
+    used += length;
+  }
+
+  /** @brief Formats into the buffer. One call must stay below RESPONSE_CHUNK_SIZE, longer output is truncated. */
+  __attribute__((format(printf, 2, 3))) void writef(const char* format, ...) {
+    for (int attempt = 0; attempt < 2; attempt++) {
+      va_list args;
+      va_start(args, format);
+      int length = vsnprintf(buffer + used, sizeof(buffer) - used, format, args);
+      va_end(args);
+      if (length >= 0 && (size_t)length < sizeof(buffer) - used) {
+        used += length;
+        return;
+      }
+      if (used == 0) {
+        used = sizeof(buffer) - 1;
+        return;
+      }
+      flush();
+    }
+  }
+
+  /** @brief Writes text as a quoted JSON string, escaping quotes, backslashes and control characters. */
+  void writeJsonString(const char* text) {
+    write("\"", 1);
+    for (; *text != '\0'; text++) {
+      unsigned char c = (unsigned char)*text;
+      if (c == '"' || c == '\\') {
+        char escaped[2] = { '\\', (char)c };
+        write(escaped, 2);
+      } else if (c < 0x20) {
+        writef("\\u%04x", c);
+      } else {
+        write(text, 1);
+      }
+    }
+    write("\"", 1);
+  }
+
+  void flush() {
+    if (used > 0) {
+      web.sendContent(buffer, used);
+      used = 0;
     }
   }
-  displayNeedsUpdate = true;
+
+  /** @brief Flushes the buffer and sends the terminating empty chunk. */
+  void end() {
+    flush();
+    web.sendContent("");
+  }
+
+private:
+  WebServer& web;
+  char buffer[RESPONSE_CHUNK_SIZE];
+  size_t used;
+};
+
+typedef StaticJsonDocument<384> ApiRequestDocument;
+
+/**
+ * @brief Rejects unauthenticated API calls with a JSON 401 and refreshes the session timer.
+ * @return True if the request may proceed.
+ */
+bool requireApiAuth() {
+  lastActivityTimeWeb = millis();
+  if (isAuthenticated) return true;
+  server.send(401, "application/json", "{\"ok\":false,\"error\":\"Not authorized.\"}");
+  return false;
+}
+
+/**
+ * @brief Answers an API call with {"ok":...}. A null error means success.
+ * @param message Optional text shown by the admin app on success (no quotes or backslashes).
+ */
+void sendApiResult(int code, const char* error, const char* message) {
+  char body[192];
+  if (error != nullptr) {
+    snprintf(body, sizeof(body), "{\"ok\":false,\"error\":\"%s\"}", error);
+  } else if (message != nullptr) {
+    snprintf(body, sizeof(body), "{\"ok\":true,\"message\":\"%s\"}", message);
+  } else {
+    snprintf(body, sizeof(body), "{\"ok\":true}");
+  }
+  server.send(code, "application/json", body);
 }
 
 /**
- * @brief Activates or deactivates a relay for a specific slot via I2C.
- * @param slot The slot index (0-15).
- * @param activate True to activate the relay, false to deactivate.
- * @return True on success, false on I2C communication failure.
+ * @brief Checks authentication and parses the JSON request body. Answers the request on failure.
+ * @return True if doc holds a JSON object.
  */
-bool controlSlotRelay(int slot, bool activate) {
-  if (slot < 0 || slot >= MAX_SLOTS) {
-    logMessage("ERROR: Invalid slot index for relay: " + String(slot));
+bool parseApiRequest(ApiRequestDocument& doc) {
+  if (!requireApiAuth()) return false;
+  DeserializationError error = deserializeJson(doc, server.arg("plain"));
+  if (error || !doc.is<JsonObject>()) {
+    sendApiResult(400, "Invalid JSON.");
     return false;
   }
+  return true;
+}
 
-  // Update the bitmask for the relay states
-  if (activate) {
-    expanderOutputStates[0] |= (1 << slot);
-  } else {
-    expanderOutputStates[0] &= ~(1 << slot);
-  }
-  
-  // Determine which register (Port A or B) and data byte to send
-  uint8_t relayCommand = (slot < 8) ? 0x02 : 0x03; // GPIOB or GPIOA
-  uint8_t dataByte = (slot < 8) ? (uint8_t)(expanderOutputStates[0] & 0xFF) : (uint8_t)(expanderOutputStates[0] >> 8);
-  
-  // Send the command over I2C
-  Wire.beginTransmission(RELAY_I2C_ADDRESS);
-  Wire.write(relayCommand);
-  Wire.write(dataByte);
-  byte error = Wire.endTransmission();
-
-  if (error == 0) {
-    logMessage("Relay for slot " + String(slot + 1) + (activate ? " ON" : " OFF") + " command sent successfully.");
-    lastRelayChangeTime = millis();
-    return true;
+/**
+ * @brief Posts a command to the vending task and answers the API call accordingly.
+ */
+void postVendingCommandForApi(VendingCommandType type, int slot = -1, float value = 0.0f, const char* message = nullptr) {
+  if (postVendingCommand(type, slot, value)) {
+    sendApiResult(200, nullptr, message);
   } else {
-    logMessage("ERROR: I2C failed for slot " + String(slot + 1) + ". Code: " + String(error));
-    return false;
+    sendApiResult(503, "Busy, please retry.");
   }
 }
 
 /**
- * @brief Initializes a dispense job for a given slot.
- * @param slotToDispense The slot index to be dispensed.
+ * @brief Returns the live machine state (credit, slots, Telegram and I2C counters) as compact JSON.
+ *        Slots are [price, status] with status 0 = available, 1 = empty, 2 = locked.
  */
-void scheduleDispense(int slotToDispense) {
-  logMessage("scheduleDispense: Called for slot " + String(slotToDispense + 1));
-  if (dispenseJob.active) {
-    logMessage("scheduleDispense: WARNING: Dispense job already active. New request ignored.");
-    return;
-  }
-  if (!checkRelayBoardOnline()) {
-    displayErrorMessage("Relais Fehler", "Board offline");
-    return;
+void handleApiState() {
+  if (!requireApiAuth()) return;
+  VendingSnapshot snap = readVendingSnapshot();
+
+  ChunkedResponseWriter json(server);
+  server.sendHeader("Cache-Control", "no-store");
+  json.begin(200, "application/json");
+  json.writef("{\"credit\":%.2f,\"uptimeMin\":%lu,\"slots\":[", snap.credit, millis() / 60000);
+  for (int i = 0; i < snap.activeSlots; i++) {
+    int status = snap.slotLocked[i] ? 2 : (snap.slotAvailable[i] ? 0 : 1);
+    json.writef("%s[%.2f,%d]", i > 0 ? "," : "", snap.slotPrices[i], status);
   }
-
-  // Set up the dispense job
-  dispenseJob.active = true;
-  dispenseJob.slot = slotToDispense;
-  dispenseJob.startTime = millis();
-  dispenseJob.relayActivated = false;
-  logMessage("Dispense job scheduled for slot " + String(slotToDispense + 1));
-  currentSystemState = CurrentSystemState::USER_INTERACTION;
-  
-  // Display message to user
-  tft.fillScreen(ILI9341_BLACK);
-  tft.setFont(&Poppins_Regular10pt7b);
-  tft.setTextColor(ILI9341_CYAN);
-  tft.setCursor(10, 100);
-  tft.print("Fach "); tft.print(dispenseJob.slot + 1);
-  tft.setCursor(10, 130);
-  tft.print("wird vorbereitet...");
-  displayNeedsUpdate = true;
+  json.writef("],\"telegram\":{\"queue\":%u,\"queueMax\":%d,\"sent\":%u,\"retries\":%u,\"failed\":%u,\"dropped\":%u}",
+              (unsigned)getTelegramQueueDepth(), TELEGRAM_QUEUE_LENGTH, (unsigned)telegramMessagesSent,
+              (unsigned)telegramRetries, (unsigned)telegramMessagesFailed, (unsigned)telegramMessagesDropped);
+  json.writef(",\"learn\":{\"active\":%s,\"acceptor\":%u,\"value\":%u,\"lastPulses\":%d,\"conflict\":%d,\"samples\":[%u,%u],"
+              "\"intervalSamples\":[%u,%u],\"minSamples\":%d,\"suggested\":[%lu,%lu]}",
+              pulseLearn.active ? "true" : "false", pulseLearn.acceptor, pulseLearn.value, pulseLearn.lastPulses, pulseLearn.conflictPulses,
+              pulseLearn.samples[PULSE_ACCEPTOR_COIN], pulseLearn.samples[PULSE_ACCEPTOR_BILL],
+              pulseLearn.intervalSamples[PULSE_ACCEPTOR_COIN], pulseLearn.intervalSamples[PULSE_ACCEPTOR_BILL], LEARN_MIN_INTERVAL_SAMPLES,
+              learnedGroupTimeoutMs(PULSE_ACCEPTOR_COIN), learnedGroupTimeoutMs(PULSE_ACCEPTOR_BILL));
+  json.writef(",\"cctalk\":[{\"online\":%s,\"rejected\":%u,\"lost\":%u},{\"online\":%s,\"rejected\":%u,\"lost\":%u}]",
+              ccTalkCoin.online ? "true" : "false", (unsigned)ccTalkCoin.rejected, (unsigned)ccTalkCoin.lost,
+              ccTalkBill.online ? "true" : "false", (unsigned)ccTalkBill.rejected, (unsigned)ccTalkBill.lost);
+  json.writef(",\"cashless\":{\"enabled\":%s,\"online\":%s}", cashlessIsEnabled() ? "true" : "false", cashlessOnline ? "true" : "false");
+  json.writef(",\"i2c\":{\"online\":%s,\"upSec\":%lu,\"retries\":%u,\"recoveries\":%u,\"failed\":%u,\"brownouts\":%u,\"readback\":%u}}",
+              relayBoardOnline ? "true" : "false", relayBoardOnline ? (unsigned long)(millis() - relayBoardOnlineSince) / 1000 : 0UL,
+              (unsigned)i2cRetries, (unsigned)i2cRecoveries, (unsigned)i2cFailures, (unsigned)relayBrownouts, (unsigned)relayReadbackErrors);
+  json.end();
 }
 
 /**
- * @brief Manages the active dispense job, from activating the relay to deactivating it after a timeout.
+ * @brief Returns the stored settings for the configuration forms of the admin app.
  */
-void processDispenseJob() {
-  if (!dispenseJob.active) return;
-
-  unsigned long currentTime = millis();
-  currentSystemState = CurrentSystemState::USER_INTERACTION;
-
-  // --- Step 1: Activate Relay and Process Payment ---
-  if (!dispenseJob.relayActivated) {
-    digitalWrite(BILL_INHIBIT_PIN, HIGH); // Inhibit bill acceptor during dispense
-
-    if (!controlSlotRelay(dispenseJob.slot, true)) {
-      logMessage("processDispenseJob: ERROR activating relay for slot " + String(dispenseJob.slot + 1));
-      displayErrorMessage("Relais Fehler", "Kauf abgebrochen");
-      dispenseJob.active = false;
-      digitalWrite(BILL_INHIBIT_PIN, LOW);
-      resetDisplayToDefault();
-      return;
-    }
-     
-    // Deduct credit and update slot availability
-    credit -= slotPrices[dispenseJob.slot];
-    if (credit < 0) credit = 0;
-    slotAvailable[dispenseJob.slot] = false;
-    logMessage("Purchase complete for slot " + String(dispenseJob.slot + 1) + ". New credit: " + String(credit, 2));
-
-    // Persist changes to Preferences
-    preferences.begin("hanimat", false);
-    preferences.putFloat("credit", credit);
-    preferences.putBool(("avail" + String(dispenseJob.slot)).c_str(), slotAvailable[dispenseJob.slot]);
-    preferences.end();
-    
-    // Send notifications
-    if (telegramNotifyOnSale) {
-        String saleMessage = "🍯 VERKAUF: Fach #" + String(dispenseJob.slot + 1) + " wurde verkauft und ist jetzt leer.";
-        sendTelegramMessage(saleMessage);
-    }
-    checkOverallStockLevel();
-
-    // Play sound and update display
-    playThankYouMelody();
-    tft.fillScreen(ILI9341_BLACK);
-    tft.setFont(&Poppins_Black14pt7b);
-    tft.setTextColor(ILI9341_GREEN);
-    tft.setCursor(10, 100);
-    tft.println("Danke!");
-     
-    tft.setFont(&Poppins_Regular10pt7b);
-    tft.setCursor(10, 140);
-    tft.print("Fach "); tft.print(dispenseJob.slot + 1); tft.print(" offen.");
-
-    // Mark step 1 as complete
-    dispenseJob.relayActivated = true;
-    dispenseJob.startTime = currentTime; // Reset timer for dispense duration
-    displayNeedsUpdate = true;
+void handleApiConfig() {
+  if (!requireApiAuth()) return;
+
+  char slogan[SLOGAN_MAX_LENGTH * 4 + 1] = "";  // UTF-8, up to 4 bytes per character
+  char footer[128] = "www.hanimat.at";
+  char staticIP[16] = "", gateway[16] = "", subnet[16] = "", dns1[16] = "8.8.8.8";
+  webPreferences.begin("hanimat", true);
+  if (webPreferences.isKey("dispSlogan")) webPreferences.getString("dispSlogan", slogan, sizeof(slogan));
+  if (webPreferences.isKey("dispFooter")) webPreferences.getString("dispFooter", footer, sizeof(footer));
+  if (webPreferences.isKey("static_ip")) webPreferences.getString("static_ip", staticIP, sizeof(staticIP));
+  if (webPreferences.isKey("gateway")) webPreferences.getString("gateway", gateway, sizeof(gateway));
+  if (webPreferences.isKey("subnet")) webPreferences.getString("subnet", subnet, sizeof(subnet));
+  if (webPreferences.isKey("dns1")) webPreferences.getString("dns1", dns1, sizeof(dns1));
+  webPreferences.end();
+
+  ChunkedResponseWriter json(server);
+  server.sendHeader("Cache-Control", "no-store");
+  json.begin(200, "application/json");
+  json.write("{\"firmware\":");
+  json.writeJsonString(FIRMWARE_VERSION.c_str());
+  json.writef(",\"maxSlots\":%d,\"relaySlots\":%d,\"timing\":{\"coinDelay\":%lu,\"billGroupTimeout\":%lu,\"dispenseTime\":%lu,\"dispenseConcurrency\":%u,\"keypadTimeout\":%lu,\"slotSelectTimeout\":%lu,\"displayTimeout\":%lu}",
+              MAX_SLOTS, relaySlotCount(), (unsigned long)COIN_PROCESSING_DELAY,
+              (unsigned long)BILL_GROUP_PROCESSING_TIMEOUT_MS, (unsigned long)DISPENSE_RELAY_ON_TIME, dispenseConcurrency,
+              (unsigned long)KEYPAD_INPUT_TIMEOUT, (unsigned long)SLOT_SELECTION_TIMEOUT, (unsigned long)DISPLAY_TIMEOUT);
+  json.writef(",\"telegram\":{\"enabled\":%s,\"notifySale\":%s,\"notifyAlmostEmpty\":%s,\"notifyEmpty\":%s,\"almostEmptyThreshold\":%d,\"token\":",
+              telegramEnabled ? "true" : "false", telegramNotifyOnSale ? "true" : "false",
+              telegramNotifyAlmostEmpty ? "true" : "false", telegramNotifyEmpty ? "true" : "false", almostEmptyThreshold);
+  xSemaphoreTake(telegramConfigMutex, portMAX_DELAY);
+  json.writeJsonString(telegramBotToken.c_str());
+  json.write(",\"chatId\":");
+  json.writeJsonString(telegramChatId.c_str());
+  xSemaphoreGive(telegramConfigMutex);
+  json.writef("},\"payment\":{\"coin\":[");
+  for (int i = 0; i < PULSE_TABLE_SIZE; i++) json.writef("%s%u", i > 0 ? "," : "", pulseValues[i]);
+  json.write("],\"bill\":[");
+  for (int i = 0; i < PULSE_TABLE_SIZE; i++) json.writef("%s%u", i > 0 ? "," : "", billValues[i]);
+  json.writef("]},\"cctalk\":{\"enabled\":%s", PAYMENT_CCTALK ? "true" : "false");
+  const CcTalkDevice* ccTalkDevices[] = { &ccTalkCoin, &ccTalkBill };
+  for (const CcTalkDevice* device : ccTalkDevices) {
+    json.writef(",\"%s\":{\"mask\":%u,\"values\":[", device->acceptor == PULSE_ACCEPTOR_COIN ? "coin" : "bill", (unsigned)device->enableMask);
+    for (int i = 0; i < CCTALK_TYPES; i++) json.writef("%s%u", i > 0 ? "," : "", device->values[i]);
+    json.write("]}");
   }
+  xSemaphoreTake(cashlessConfigMutex, portMAX_DELAY);
+  json.writef("},\"cashless\":{\"enabled\":%s,\"host\":", cashlessEnabled ? "true" : "false");
+  json.writeJsonString(cashlessHost);
+  json.writef(",\"port\":%u", cashlessPort);
+  xSemaphoreGive(cashlessConfigMutex);
+  json.writef("},\"doors\":{\"openHigh\":%s", doorOpenHigh ? "true" : "false");
+  json.writef("},\"display\":{\"sloganMax\":%d,\"slogan\":", SLOGAN_MAX_LENGTH);
+  json.writeJsonString(slogan);
+  json.write(",\"footer\":");
+  json.writeJsonString(footer);
+  IPAddress localIP = WiFi.localIP();
+  json.writef("},\"network\":{\"ip\":\"%u.%u.%u.%u\",\"staticIp\":", localIP[0], localIP[1], localIP[2], localIP[3]);
+  json.writeJsonString(staticIP);
+  json.write(",\"gateway\":");
+  json.writeJsonString(gateway);
+  json.write(",\"subnet\":");
+  json.writeJsonString(subnet);
+  json.write(",\"dns1\":");
+  json.writeJsonString(dns1);
+  json.writef("},\"log\":{\"level\":%d,\"maxLevel\":%d}}", (int)logRuntimeLevel, LOG_COMPILE_LEVEL);
+  json.end();
+}
 
-  // --- Step 2: Deactivate Relay after Timeout ---
-  if (dispenseJob.relayActivated && (currentTime - dispenseJob.startTime >= DISPENSE_RELAY_ON_TIME)) {
-    logMessage("Dispense time elapsed. Deactivating relay for slot " + String(dispenseJob.slot + 1));
-    controlSlotRelay(dispenseJob.slot, false);
-
-    // Finalize job
-    dispenseJob.active = false;
-    digitalWrite(BILL_INHIBIT_PIN, LOW); // Re-enable bill acceptor
-    resetDisplayToDefault();
+/**
+ * @brief Adjusts the credit ({"adjust": euros}) or resets it ({"reset": true}).
+ */
+void handleApiCredit() {
+  ApiRequestDocument doc;
+  if (!parseApiRequest(doc)) return;
+  if (doc["reset"] | false) {
+    postVendingCommandForApi(VendingCommandType::RESET_CREDIT, -1, 0.0f, "Guthaben zurückgesetzt.");
+  } else if (doc.containsKey("adjust")) {
+    float amount = doc["adjust"] | 0.0f;
+    if (amount == 0) { sendApiResult(400, "Amount is 0."); return; }
+    postVendingCommandForApi(VendingCommandType::ADJUST_CREDIT, -1, amount, "Guthaben angepasst.");
+  } else {
+    sendApiResult(400, "Amount missing.");
   }
 }
 
 /**
- * @brief Processes coin pulses after a delay to group them into a single coin event.
+ * @brief Sets the price of a slot ({"slot": index, "price": euros}).
  */
-void processAcceptedCoin() {
-  if (coinPulseCount > 0 && (millis() - lastCoinPulseTime > COIN_PROCESSING_DELAY)) {
-    int pulsesToProcess;
-    noInterrupts();
-    pulsesToProcess = coinPulseCount;
-    coinPulseCount = 0;
-    interrupts();
-
-    logMessage("Coin: Processing " + String(pulsesToProcess) + " pulses.");
-
-    if (pulsesToProcess > 0 && pulsesToProcess < (sizeof(pulseValues) / sizeof(pulseValues[0]))) {
-      int coinValueCents = pulseValues[pulsesToProcess];
-      if (coinValueCents > 0) {
-        credit += (float)coinValueCents / 100.0;
-        logMessage("Coin accepted: " + String(pulsesToProcess) + " pulses -> " + String((float)coinValueCents / 100.0, 2) + " EUR. New credit: " + String(credit, 2) + " EUR");
-        
-        preferences.begin("hanimat", false);
-        preferences.putFloat("credit", credit);
-        preferences.end();
-
-        displayNeedsUpdate = true;
-        lastUserInteractionTime = millis();
-        currentSystemState = CurrentSystemState::USER_INTERACTION;
-        ledcWriteTone(0, 1200); delay(100); ledcWriteTone(0,0);
-      } else {
-        logMessage("Coin: " + String(pulsesToProcess) + " pulses has a value of 0 (invalid pulse count).");
-      }
-    } else {
-      logMessage("Coin: Invalid pulse count rejected: " + String(pulsesToProcess));
-    }
-  }
+void handleApiSlotPrice() {
+  ApiRequestDocument doc;
+  if (!parseApiRequest(doc)) return;
+  int slot = doc["slot"] | -1;
+  float price = doc["price"] | -1.0f;
+  VendingSnapshot snap = readVendingSnapshot();
+  if (slot < 0 || slot >= snap.activeSlots || price < 0) { sendApiResult(400, "Invalid input."); return; }
+  postVendingCommandForApi(VendingCommandType::SET_PRICE, slot, price, "Preis aktualisiert.");
 }
 
 /**
- * @brief Processes bill pulses after a timeout to group them into a single bill event.
+ * @brief Refills one slot ({"slot": index}) or all unlocked slots ({}).
  */
-void processBillAcceptorPulses() {
-  // Ignore pulses immediately after a relay change to prevent electrical noise
-  if (millis() - lastRelayChangeTime < 1000) {
-    if (billAcceptorPulseCount > 0) {
-      logMessage("Bill: Pulses ignored (noise after relay action). Count: " + String(billAcceptorPulseCount));
-      noInterrupts(); billAcceptorPulseCount = 0; interrupts();
-    }
+void handleApiSlotRefill() {
+  ApiRequestDocument doc;
+  if (!parseApiRequest(doc)) return;
+  int slot = doc["slot"] | -1;
+  if (slot < 0) {
+    postVendingCommandForApi(VendingCommandType::REFILL_ALL, -1, 0.0f, "Alle Fächer aufgefüllt.");
     return;
   }
+  VendingSnapshot snap = readVendingSnapshot();
+  if (slot >= snap.activeSlots) { sendApiResult(400, "Invalid slot."); return; }
+  if (snap.slotLocked[slot]) { sendApiResult(409, "Fach ist gesperrt."); return; }
+  postVendingCommandForApi(VendingCommandType::REFILL_SLOT, slot, 0.0f, "Fach aufgefüllt.");
+}
 
-  if (billAcceptorPulseCount > 0 && (millis() - lastBillPulseEdgeTime > BILL_GROUP_PROCESSING_TIMEOUT_MS)) {
-    int pulsesToProcess;
-    noInterrupts();
-    pulsesToProcess = billAcceptorPulseCount;
-    billAcceptorPulseCount = 0;
-    interrupts();
-
-    logMessage("Bill: Processing " + String(pulsesToProcess) + " pulses.");
-
-    if (pulsesToProcess > 0 && pulsesToProcess < (sizeof(billValues) / sizeof(billValues[0]))) {
-      int billValueEuros = billValues[pulsesToProcess];
-      if (billValueEuros > 0) {
-        credit += billValueEuros;
-        logMessage("Bill accepted: " + String(pulsesToProcess) + " pulses -> " + String(billValueEuros) + " EUR. New credit: " + String(credit, 2) + " EUR");
-        
-        preferences.begin("hanimat", false);
-        preferences.putFloat("credit", credit);
-        preferences.end();
+/**
+ * @brief Toggles the lock of a slot ({"slot": index}).
+ */
+void handleApiSlotLock() {
+  ApiRequestDocument doc;
+  if (!parseApiRequest(doc)) return;
+  int slot = doc["slot"] | -1;
+  VendingSnapshot snap = readVendingSnapshot();
+  if (slot < 0 || slot >= snap.activeSlots) { sendApiResult(400, "Invalid slot."); return; }
+  postVendingCommandForApi(VendingCommandType::TOGGLE_SLOT_LOCK, slot, 0.0f, "Fachstatus geändert.");
+}
 
-        displayNeedsUpdate = true;
-        lastUserInteractionTime = millis();
-        currentSystemState = CurrentSystemState::USER_INTERACTION;
-        ledcWriteTone(0, 1000); delay(150); ledcWriteTone(0,0);
-      } else {
-        logMessage("Bill: " + String(pulsesToProcess) + " pulses has a value of 0.");
-      }
-    } else {
-      logMessage("Bill: Invalid pulse count rejected: " + String(pulsesToProcess));
-    }
+/**
+ * @brief Tests the relay of one slot ({"slot": index}) or all relays in sequence ({}).
+ */
+void handleApiSlotTest() {
+  ApiRequestDocument doc;
+  if (!parseApiRequest(doc)) return;
+  int slot = doc["slot"] | -1;
+  if (slot < 0) {
+    postVendingCommandForApi(VendingCommandType::TEST_ALL_RELAYS, -1, 0.0f, "Alle Relais werden getestet.");
+    return;
   }
-   
-  // Inhibit the bill acceptor while pulses are being received, re-enable when done.
-  digitalWrite(BILL_INHIBIT_PIN, (billAcceptorPulseCount > 0) ? HIGH : LOW);
+  VendingSnapshot snap = readVendingSnapshot();
+  if (slot >= snap.activeSlots) { sendApiResult(400, "Invalid slot."); return; }
+  postVendingCommandForApi(VendingCommandType::TEST_RELAY, slot, 0.0f, "Relais ausgelöst.");
 }
 
 /**
- * @brief Displays a centered, two-line error message on the TFT for a short duration.
- * @param line1 The first (main) line of the error message.
- * @param line2 The second (optional) line of the error message.
+ * @brief Sets the number of active slots ({"count": n}).
  */
-void displayErrorMessage(const String &line1, const String &line2) {
-    logMessage("Display Error: " + line1 + (line2.length() > 0 ? " | " + line2 : ""));
-    currentSystemState = CurrentSystemState::ERROR_DISPLAY;
-    tft.fillScreen(ILI9341_BLACK);
-
-    int16_t x1, y1;
-    uint16_t w, h;
-
-    tft.setFont(&Poppins_Regular10pt7b);
-    tft.setTextColor(ILI9341_RED);
-
-    // Line 1
-    tft.getTextBounds(line1, 0, 0, &x1, &y1, &w, &h);
-    tft.setCursor((tft.width() - w) / 2, 100);
-    tft.println(line1);
-
-    // Line 2 (if present)
-    if (line2.length() > 0) {
-        tft.getTextBounds(line2, 0, 0, &x1, &y1, &w, &h);
-        tft.setCursor((tft.width() - w) / 2, 130);
-        tft.println(line2);
-    }
-
-    playErrorSound();
-    displayNeedsUpdate = false;
-    unsigned long errorTime = millis();
-    while(millis() - errorTime < 3000) { // Show error for 3 seconds
-        server.handleClient();
-        delay(10);
-    }
-    resetDisplayToDefault();
+void handleApiSlotCount() {
+  ApiRequestDocument doc;
+  if (!parseApiRequest(doc)) return;
+  int count = doc["count"] | 0;
+  if (count <= 0 || count > MAX_SLOTS) { sendApiResult(400, "Invalid slot count."); return; }
+  postVendingCommandForApi(VendingCommandType::SET_ACTIVE_SLOTS, count, 0.0f, "Anzahl Fächer aktualisiert. Neustart empfohlen.");
 }
 
+/**
+ * @brief Stores the timing settings. They take effect after a restart.
+ */
+void handleApiTimingConfig() {
+  ApiRequestDocument doc;
+  if (!parseApiRequest(doc)) return;
+
+  webPreferences.begin("hanimat", false);
+  webPreferences.putULong("coinDelay", doc["coinDelay"] | (unsigned long)COIN_PROCESSING_DELAY);
+  webPreferences.putULong("billGrpTout", doc["billGroupTimeout"] | (unsigned long)BILL_GROUP_PROCESSING_TIMEOUT_MS);
+  webPreferences.putULong("dispTime", doc["dispenseTime"] | (unsigned long)DISPENSE_RELAY_ON_TIME);
+  int concurrency = doc["dispenseConcurrency"] | (int)dispenseConcurrency;
+  webPreferences.putUChar("dispConc", (uint8_t)constrain(concurrency, 1, DISPENSE_MAX_CONCURRENCY));
+  webPreferences.putULong("keypadTime", doc["keypadTimeout"] | (unsigned long)KEYPAD_INPUT_TIMEOUT);
+  webPreferences.putULong("slotSelTime", doc["slotSelectTimeout"] | (unsigned long)SLOT_SELECTION_TIMEOUT);
+  webPreferences.putULong("dispTimeout", doc["displayTimeout"] | (unsigned long)DISPLAY_TIMEOUT);
+  webPreferences.end();
+
+  LOG_INFO("Web: Timing settings saved. A restart is recommended.");
+  sendApiResult(200, nullptr, "Zeiteinstellungen gespeichert! Neustart empfohlen.");
+}
 
-// =================================================================
-//                      WEB SERVER HANDLERS
-// =================================================================
+/**
+ * @brief Stores the Telegram and stock notification settings.
+ */
+void handleApiTelegramConfig() {
+  ApiRequestDocument doc;
+  if (!parseApiRequest(doc)) return;
+
+  telegramEnabled = doc["enabled"] | false;
+  telegramNotifyOnSale = doc["notifySale"] | false;
+  telegramNotifyAlmostEmpty = doc["notifyAlmostEmpty"] | false;
+  telegramNotifyEmpty = doc["notifyEmpty"] | false;
+  xSemaphoreTake(telegramConfigMutex, portMAX_DELAY);
+  telegramBotToken = doc["token"] | "";
+  telegramChatId = doc["chatId"] | "";
+  xSemaphoreGive(telegramConfigMutex);
+  almostEmptyThreshold = doc["almostEmptyThreshold"] | almostEmptyThreshold;
+
+  webPreferences.begin("hanimat", false);
+  webPreferences.putBool("tgEnabled", telegramEnabled);
+  webPreferences.putString("tgToken", telegramBotToken);
+  webPreferences.putString("tgChatId", telegramChatId);
+  webPreferences.putInt("tgAlmostThres", almostEmptyThreshold);
+  webPreferences.putBool("tgNotifySale", telegramNotifyOnSale);
+  webPreferences.putBool("tgNotifyAlmost", telegramNotifyAlmostEmpty);
+  webPreferences.putBool("tgNotifyEmpty", telegramNotifyEmpty);
+  webPreferences.end();
+
+  LOG_INFO("Web: Telegram & notification settings saved.");
+  sendApiResult(200, nullptr, "Einstellungen gespeichert!");
+}
 
 /**
- * @brief Handles requests to the root URL ("/"). Shows login or dashboard.
+ * @brief Stores slogan and footer; the vending task reloads them from NVS.
  */
-void handleRoot() {
-  lastActivityTimeWeb = millis();
-  if (!isAuthenticated) {
-    showLoginPage();
-  } else {
-    showDashboard();
-  }
+void handleApiDisplayConfig() {
+  ApiRequestDocument doc;
+  if (!parseApiRequest(doc)) return;
+
+  // Texte auf maximale Länge kürzen
+  String newSlogan = doc["slogan"] | "";
+  if (newSlogan.length() > SLOGAN_MAX_LENGTH) newSlogan = newSlogan.substring(0, SLOGAN_MAX_LENGTH);
+  String newFooter = doc["footer"] | "";
+  if (newFooter.length() > 30) newFooter = newFooter.substring(0, 30);
+
+  webPreferences.begin("hanimat", false);
+  webPreferences.putString("dispSlogan", newSlogan);
+  webPreferences.putString("dispFooter", newFooter);
+  webPreferences.end();
+  postVendingCommand(VendingCommandType::RELOAD_DISPLAY_TEXTS);
+
+  LOG_INFO("Web: Display texts updated.");
+  sendApiResult(200, nullptr, "Display-Texte gespeichert!");
 }
 
 /**
- * @brief Handles the login form submission.
+ * @brief Stores the static IP configuration and restarts.
  */
-void handleLogin() {
-  lastActivityTimeWeb = millis();
-  if (server.hasArg("password") && server.arg("password") == savedPassword) {
-    isAuthenticated = true;
-    logMessage("Web: Login successful.");
-    server.sendHeader("Location", "/", true);
-    server.send(302, "text/plain", "");
-  } else {
-    logMessage("Web: Login failed.");
-    showLoginPage();
+void handleApiNetworkConfig() {
+  ApiRequestDocument doc;
+  if (!parseApiRequest(doc)) return;
+  if (!doc.containsKey("staticIp") || !doc.containsKey("gateway") || !doc.containsKey("subnet")) {
+    sendApiResult(400, "Missing parameters.");
+    return;
   }
+
+  webPreferences.begin("hanimat", false);
+  webPreferences.putString("static_ip", doc["staticIp"] | "");
+  webPreferences.putString("gateway", doc["gateway"] | "");
+  webPreferences.putString("subnet", doc["subnet"] | "");
+  const char* dns1 = doc["dns1"] | "";
+  if (dns1[0] != '\0') webPreferences.putString("dns1", dns1); else webPreferences.remove("dns1");
+  webPreferences.end();
+  postVendingCommand(VendingCommandType::FLUSH_SETTINGS);
+  LOG_INFO("Web: Static IP settings saved. Restart required.");
+  sendApiResult(200, nullptr, "Netzwerkeinstellungen gespeichert. Neustart in 5 Sek...");
+  delay(5000); ESP.restart();
 }
 
 /**
- * @brief Handles the change password form submission.
+ * @brief Changes the admin password ({"password": "..."}, min. 4 characters).
  */
-void handleChangePasswordWeb() {
-  lastActivityTimeWeb = millis();
-  if (!isAuthenticated) { server.send(401, "text/plain", "Not authorized."); return; }
-  if (server.hasArg("newPassword")) {
-    String newPass = server.arg("newPassword");
-    if (newPass.length() >= 4) {
-        savedPassword = newPass;
-        preferences.begin("hanimat", false);
-        preferences.putString("password", savedPassword);
-        preferences.end();
-        logMessage("Web: Admin password changed.");
-        server.send(200, "text/html", "Passwort geändert. <meta http-equiv='refresh' content='2;url=/' />");
-    } else {
-        server.send(400, "text/html", "Passwort zu kurz (min. 4 Zeichen). <meta http-equiv='refresh' content='2;url=/' />");
-    }
-  } else { server.send(400, "text/plain", "New password missing."); }
+void handleApiPassword() {
+  ApiRequestDocument doc;
+  if (!parseApiRequest(doc)) return;
+  String newPass = doc["password"] | "";
+  if (newPass.length() < 4) { sendApiResult(400, "Passwort zu kurz (min. 4 Zeichen)."); return; }
+
+  savedPassword = newPass;
+  webPreferences.begin("hanimat", false);
+  webPreferences.putString("password", savedPassword);
+  webPreferences.end();
+  LOG_INFO("Web: Admin password changed.");
+  sendApiResult(200, nullptr, "Passwort geändert.");
 }
 
 /**
- * @brief Handles updating the price of a slot.
+ * @brief Sets the runtime log level ({"level": n}) and stores it for the next boot.
  */
-void handleUpdatePriceWeb() {
-  lastActivityTimeWeb = millis();
-  if (!isAuthenticated) { server.send(401, "text/plain", "Not authorized."); return; }
-  if (server.hasArg("slot") && server.hasArg("price")) {
-    int slot = server.arg("slot").toInt();
-    float price = server.arg("price").toFloat();
-    if (slot >= 0 && slot < activeSlots && price >= 0) {
-      slotPrices[slot] = price;
-      preferences.begin("hanimat", false);
-      preferences.putFloat(("price" + String(slot)).c_str(), price);
-      preferences.end();
-      logMessage("Web: Price for slot " + String(slot + 1) + " changed to " + String(price, 2) + " EUR.");
-      server.send(200, "text/html", "Preis aktualisiert. <meta http-equiv='refresh' content='1;url=/' />");
-      displayNeedsUpdate = true;
-    } else { server.send(400, "text/plain", "Invalid input."); }
-  } else { server.send(400, "text/plain", "Missing parameters."); }
-}
-
-/**
- * @brief Handles refilling a single slot.
- */
-void handleRefillWeb() {
-  lastActivityTimeWeb = millis();
-  if (!isAuthenticated) { server.send(401, "text/plain", "Not authorized."); return; }
-  if (server.hasArg("slot")) {
-    int slot = server.arg("slot").toInt();
-    if (slot >= 0 && slot < activeSlots) {
-      if (!slotLocked[slot]) {
-          slotAvailable[slot] = true;
-          preferences.begin("hanimat", false);
-          preferences.putBool(("avail" + String(slot)).c_str(), true);
-          preferences.end();
-          logMessage("Web: Slot " + String(slot + 1) + " refilled.");
-          checkOverallStockLevel();
-          server.send(200, "text/html", "Fach aufgefuellt. <meta http-equiv='refresh' content='1;url=/' />");
-          displayNeedsUpdate = true;
-      } else { server.send(400, "text/html", String("Fach ") + (slot+1) + " ist gesperrt. <meta http-equiv='refresh' content='2;url=/' />");}
-    } else { server.send(400, "text/plain", "Invalid slot."); }
-  } else { server.send(400, "text/plain", "Missing parameters."); }
+void handleApiLogLevel() {
+  ApiRequestDocument doc;
+  if (!parseApiRequest(doc)) return;
+
+  int level = constrain((int)(doc["level"] | (int)LOG_LEVEL_INFO), LOG_LEVEL_ERROR, LOG_COMPILE_LEVEL);
+  logRuntimeLevel = level;
+  webPreferences.begin("hanimat", false);
+  webPreferences.putUChar("logLevel", level);
+  webPreferences.end();
+
+  LOG_INFO("Web: Log level set to %d.", level);
+  sendApiResult(200, nullptr, "Log-Level gespeichert.");
 }
 
 /**
- * @brief Handles manually adding or removing credit.
+ * @brief Parses the "acceptor" field ("coin" or "bill"). Returns PULSE_ACCEPTOR_COUNT otherwise.
  */
-void handleAddCreditWeb() {
-  lastActivityTimeWeb = millis();
-  if (!isAuthenticated) { server.send(401, "text/plain", "Not authorized."); return; }
-  if (server.hasArg("amount")) {
-    float amount = server.arg("amount").toFloat();
-    if (amount != 0) {
-        credit += amount;
-        preferences.begin("hanimat", false);
-        preferences.putFloat("credit", credit);
-        preferences.end();
-        logMessage("Web: Credit adjusted by " + String(amount, 2) + " EUR. New credit: " + String(credit, 2) + " EUR.");
-        server.send(200, "text/html", "Guthaben angepasst. <meta http-equiv='refresh' content='1;url=/' />");
-        displayNeedsUpdate = true;
-    } else { server.send(400, "text/plain", "Amount is 0."); }
-  } else { server.send(400, "text/plain", "Amount missing."); }
+int parseApiAcceptor(ApiRequestDocument& doc) {
+  const char* acceptor = doc["acceptor"] | "";
+  if (strcmp(acceptor, "coin") == 0) return PULSE_ACCEPTOR_COIN;
+  if (strcmp(acceptor, "bill") == 0) return PULSE_ACCEPTOR_BILL;
+  return PULSE_ACCEPTOR_COUNT;
 }
 
 /**
- * @brief Handles resetting the credit to zero.
+ * @brief Sets one entry of a pulse table ({"acceptor": "coin"|"bill", "pulses": n, "value": euros}).
+ *        A value of 0 removes the entry.
  */
-void handleResetCreditWeb() {
-  lastActivityTimeWeb = millis();
-  if (!isAuthenticated) { server.send(401, "text/plain", "Not authorized."); return; }
-  credit = 0.0;
-  preferences.begin("hanimat", false);
-  preferences.putFloat("credit", credit);
-  preferences.end();
-  logMessage("Web: Credit reset to 0.");
-  server.send(200, "text/html", "Guthaben zurueckgesetzt. <meta http-equiv='refresh' content='1;url=/' />");
-  displayNeedsUpdate = true;
+void handleApiPaymentTable() {
+  ApiRequestDocument doc;
+  if (!parseApiRequest(doc)) return;
+  int acceptor = parseApiAcceptor(doc);
+  int pulses = doc["pulses"] | 0;
+  float value = doc["value"] | -1.0f;
+  if (acceptor == PULSE_ACCEPTOR_COUNT) { sendApiResult(400, "Invalid acceptor."); return; }
+  if (pulses <= 0 || pulses >= PULSE_TABLE_SIZE) { sendApiResult(400, "Invalid pulse count."); return; }
+  if (value < 0 || value > (acceptor == PULSE_ACCEPTOR_COIN ? 655.35f : 65535.0f)) { sendApiResult(400, "Invalid value."); return; }
+  postVendingCommandForApi(acceptor == PULSE_ACCEPTOR_COIN ? VendingCommandType::SET_COIN_PULSE_VALUE : VendingCommandType::SET_BILL_PULSE_VALUE,
+                           pulses, value, value > 0 ? "Wert gespeichert." : "Eintrag entfernt.");
 }
 
 /**
- * @brief Handles refilling all available (and not locked) slots.
+ * @brief Starts learn mode for a denomination ({"acceptor": "coin"|"bill", "value": euros}),
+ *        ends it ({"acceptor": "off"}) or confirms overwriting a held-back entry ({"acceptor": "confirm"}).
  */
-void handleRefillAllWeb() {
-  lastActivityTimeWeb = millis();
-  if (!isAuthenticated) { server.send(401, "text/plain", "Not authorized."); return; }
-  preferences.begin("hanimat", false);
-  for (int i = 0; i < activeSlots; i++) {
-    if (!slotLocked[i]) {
-        slotAvailable[i] = true;
-        preferences.putBool(("avail" + String(i)).c_str(), true);
-    }
+void handleApiPaymentLearn() {
+  ApiRequestDocument doc;
+  if (!parseApiRequest(doc)) return;
+  const char* mode = doc["acceptor"] | "";
+  if (strcmp(mode, "off") == 0) {
+    postVendingCommandForApi(VendingCommandType::STOP_PULSE_LEARN, -1, 0.0f, "Lernmodus beendet.");
+    return;
   }
-  preferences.end();
-  logMessage("Web: All unlocked slots have been refilled.");
-  checkOverallStockLevel();
-  server.send(200, "text/html", "Alle Faecher aufgefuellt. <meta http-equiv='refresh' content='1;url=/' />");
-  displayNeedsUpdate = true;
+  if (strcmp(mode, "confirm") == 0) {
+    postVendingCommandForApi(VendingCommandType::CONFIRM_PULSE_LEARN, -1, 0.0f, "Eintrag überschrieben.");
+    return;
+  }
+  int acceptor = parseApiAcceptor(doc);
+  float value = doc["value"] | 0.0f;
+  if (acceptor == PULSE_ACCEPTOR_COUNT) { sendApiResult(400, "Invalid acceptor."); return; }
+  if (value <= 0) { sendApiResult(400, "Invalid value."); return; }
+  postVendingCommandForApi(VendingCommandType::START_PULSE_LEARN, acceptor, value,
+                           acceptor == PULSE_ACCEPTOR_COIN ? "Lernmodus: Münze jetzt einwerfen." : "Lernmodus: Schein jetzt einziehen lassen.");
 }
 
 /**
- * @brief Triggers a single relay for testing purposes.
+ * @brief Applies the grouping timeouts derived in learn mode.
  */
-void handleTriggerRelayWeb() {
-  lastActivityTimeWeb = millis();
-  if (!isAuthenticated) { server.send(401, "text/plain", "Not authorized."); return; }
-  if (server.hasArg("slot")) {
-    int slot = server.arg("slot").toInt();
-    if (slot >= 0 && slot < activeSlots) {
-      logMessage("Web: Testing relay for slot " + String(slot + 1));
-      controlSlotRelay(slot, true); delay(1000); controlSlotRelay(slot, false);
-      server.send(200, "text/html", String("Relais Fach ") + (slot+1) + " ausgeloest. <meta http-equiv='refresh' content='1;url=/' />");
-    } else { server.send(400, "text/plain", "Invalid slot."); }
-  } else { server.send(400, "text/plain", "Missing parameters."); }
+void handleApiPaymentLearnApply() {
+  if (!requireApiAuth()) return;
+  postVendingCommandForApi(VendingCommandType::APPLY_LEARNED_TIMEOUTS, -1, 0.0f, "Gelernte Timeouts übernommen.");
 }
 
 /**
- * @brief Triggers all relays in sequence for testing.
+ * @brief Sets which ccTalk coin/bill types are accepted ({"acceptor": "coin"|"bill", "mask": n},
+ *        bit n = type n + 1). The bus task applies it on its next poll.
  */
-void handleTriggerAllRelaysWeb() {
-  lastActivityTimeWeb = millis();
-  if (!isAuthenticated) { server.send(401, "text/plain", "Not authorized."); return; }
-  logMessage("Web: Testing all relays...");
-  for (int i = 0; i < activeSlots; i++) {
-    controlSlotRelay(i, true); delay(300); controlSlotRelay(i, false); delay(100);
+void handleApiPaymentInhibit() {
+  ApiRequestDocument doc;
+  if (!parseApiRequest(doc)) return;
+  int acceptor = parseApiAcceptor(doc);
+  long mask = doc["mask"] | -1L;
+  if (acceptor == PULSE_ACCEPTOR_COUNT) { sendApiResult(400, "Invalid acceptor."); return; }
+  if (mask < 0 || mask > 0xFFFF) { sendApiResult(400, "Invalid mask."); return; }
+
+  if (ccTalkTaskHandle != nullptr) {
+    CcTalkMaskRequest request = { (uint8_t)acceptor, (uint16_t)mask };
+    if (xQueueSend(ccTalkMaskQueue, &request, 0) != pdTRUE) { sendApiResult(503, "Busy, please retry."); return; }
+  } else {
+    (acceptor == PULSE_ACCEPTOR_COIN ? ccTalkCoin : ccTalkBill).enableMask = (uint16_t)mask; // No bus task owns it
   }
-  server.send(200, "text/html", "Alle Relais ausgeloest. <meta http-equiv='refresh' content='1;url=/' />");
+  webPreferences.begin("hanimat", false);
+  webPreferences.putUShort(acceptor == PULSE_ACCEPTOR_COIN ? "ccCoinMask" : "ccBillMask", (uint16_t)mask);
+  webPreferences.end();
+
+  LOG_INFO("Web: ccTalk %s enable mask set to 0x%04lX.", acceptor == PULSE_ACCEPTOR_COIN ? "coin" : "bill", mask);
+  sendApiResult(200, nullptr, "Annahme gespeichert.");
 }
 
 /**
- * @brief Sets static IP configuration and reboots.
+ * @brief Stores the card terminal settings ({"enabled", "host", "port"}). cashlessTask()
+ *        connects to the new address on its next attempt.
  */
-void handleSetStaticIPWeb() {
-  lastActivityTimeWeb = millis();
-  if (!isAuthenticated) { server.send(401, "text/plain", "Not authorized."); return; }
-  if (server.hasArg("static_ip") && server.hasArg("gateway") && server.hasArg("subnet")) {
-    preferences.begin("hanimat", false);
-    preferences.putString("static_ip", server.arg("static_ip"));
-    preferences.putString("gateway", server.arg("gateway"));
-    preferences.putString("subnet", server.arg("subnet"));
-    if (server.hasArg("dns1")) preferences.putString("dns1", server.arg("dns1")); else preferences.remove("dns1");
-    preferences.end();
-    logMessage("Web: Static IP settings saved. Restart required.");
-    server.send(200, "text/html", "Netzwerkeinstellungen gespeichert. Neustart in 5 Sek... <meta http-equiv='refresh' content='5;url=/' />");
-    delay(5000); ESP.restart();
-  } else { server.send(400, "text/plain", "Missing parameters."); }
+void handleApiCashlessConfig() {
+  ApiRequestDocument doc;
+  if (!parseApiRequest(doc)) return;
+  const char* host = doc["host"] | "";
+  int port = doc["port"] | (int)CASHLESS_DEFAULT_PORT;
+  if (strlen(host) >= CASHLESS_HOST_MAX_LEN) { sendApiResult(400, "Host too long."); return; }
+  if (port <= 0 || port > 65535) { sendApiResult(400, "Invalid port."); return; }
+
+  bool enabled = doc["enabled"] | false;
+  xSemaphoreTake(cashlessConfigMutex, portMAX_DELAY);
+  cashlessEnabled = enabled;
+  strncpy(cashlessHost, host, sizeof(cashlessHost) - 1);
+  cashlessHost[sizeof(cashlessHost) - 1] = '\0';
+  cashlessPort = (uint16_t)port;
+  xSemaphoreGive(cashlessConfigMutex);
+
+  webPreferences.begin("hanimat", false);
+  webPreferences.putBool("ecEnabled", enabled);
+  webPreferences.putString("ecHost", host);
+  webPreferences.putUShort("ecPort", (uint16_t)port);
+  webPreferences.end();
+
+  LOG_INFO("Web: Cashless settings saved (%s, %s:%d).", enabled ? "enabled" : "disabled", host, port);
+  sendApiResult(200, nullptr, "Einstellungen gespeichert!");
 }
 
 /**
- * @brief Updates the total number of active slots.
+ * @brief Returns the door sensor assignment and the open latency of every active slot since boot.
+ *        Slots are [type, pin, opens, notOpened, avgMs, minMs, maxMs] with type 0 = none,
+ *        1 = relay output (pin = output number 1..relayOutputs), 2 = GPIO.
  */
-void handleUpdateSlotsWeb() {
-  lastActivityTimeWeb = millis();
-  if (!isAuthenticated) { server.send(401, "text/plain", "Not authorized."); return; }
-  if (server.hasArg("maxSlots")) {
-    int newNumSlots = server.arg("maxSlots").toInt();
-    if (newNumSlots > 0 && newNumSlots <= MAX_SLOTS) {
-      activeSlots = newNumSlots;
-      preferences.begin("hanimat", false);
-      preferences.putInt("activeSlots", activeSlots);
-      // Initialize new slots if they don't exist in preferences
-      for(int i = 0; i < activeSlots; i++) {
-          if(!preferences.isKey(("avail" + String(i)).c_str())) {
-              slotAvailable[i] = true;
-              preferences.putBool(("avail" + String(i)).c_str(), true);
-          }
-            if(!preferences.isKey(("price" + String(i)).c_str())) {
-              slotPrices[i] = 5.0f;
-              preferences.putFloat(("price" + String(i)).c_str(), 5.0f);
-          }
-      }
-      preferences.end();
-      logMessage("Web: Number of active slots set to " + String(activeSlots));
-      server.send(200, "text/html", "Anzahl Faecher aktualisiert. Neustart empfohlen. <meta http-equiv='refresh' content='2;url=/' />");
-      displayNeedsUpdate = true;
-    } else { server.send(400, "text/plain", String("Invalid slot count (1-") + MAX_SLOTS + ")."); }
-  } else { server.send(400, "text/plain", "Missing parameters."); }
+void handleApiDoors() {
+  if (!requireApiAuth()) return;
+  VendingSnapshot snap = readVendingSnapshot();
+
+  ChunkedResponseWriter json(server);
+  server.sendHeader("Cache-Control", "no-store");
+  json.begin(200, "application/json");
+  json.writef("{\"openHigh\":%s,\"relayOutputs\":%d,\"gpios\":[", doorOpenHigh ? "true" : "false", relaySlotCount());
+  for (size_t i = 0; i < sizeof(DOOR_SENSOR_GPIOS); i++) json.writef("%s%u", i > 0 ? "," : "", DOOR_SENSOR_GPIOS[i]);
+  json.write("],\"slots\":[");
+  for (int i = 0; i < snap.activeSlots; i++) {
+    uint8_t sensor = doorSensors[i];
+    int type = sensor == DOOR_SENSOR_NONE ? 0 : ((sensor & DOOR_SENSOR_GPIO) ? 2 : 1);
+    int pin = type == 0 ? 0 : (type == 2 ? (sensor & ~DOOR_SENSOR_GPIO) : sensor + 1);
+    DoorStats stats = doorStats[i];
+    json.writef("%s[%d,%d,%u,%u,%lu,%u,%u]", i > 0 ? "," : "", type, pin, stats.opens, stats.notOpened,
+                stats.opens > 0 ? (unsigned long)(stats.totalMs / stats.opens) : 0UL, stats.minMs, stats.maxMs);
+  }
+  json.write("]}");
+  json.end();
 }
 
 /**
- * @brief Toggles the locked state of a slot.
+ * @brief Sets the open level of all door sensors ({"openHigh": bool}) or the sensor of one slot
+ *        ({"slot": index, "type": "none"|"relay"|"gpio", "pin": n}). Relay pins are output numbers
+ *        (1-based) above the active slots.
  */
-void handleToggleSlotLockWeb() {
-  lastActivityTimeWeb = millis();
-  if (!isAuthenticated) { server.send(401, "text/plain", "Not authorized."); return; }
-  if (server.hasArg("slot")) {
-    int slot = server.arg("slot").toInt();
-    if (slot >= 0 && slot < activeSlots) {
-      slotLocked[slot] = !slotLocked[slot];
-      preferences.begin("hanimat", false);
-      preferences.putBool(("locked" + String(slot)).c_str(), slotLocked[slot]);
-      preferences.end();
-      logMessage("Web: Slot " + String(slot + 1) + (slotLocked[slot] ? " locked." : " unlocked."));
-      server.send(200, "text/html", "Fachstatus geaendert. <meta http-equiv='refresh' content='1;url=/' />");
-      displayNeedsUpdate = true;
-    } else { server.send(400, "text/plain", "Invalid slot."); }
-  } else { server.send(400, "text/plain", "Missing parameters."); }
+void handleApiDoorConfig() {
+  ApiRequestDocument doc;
+  if (!parseApiRequest(doc)) return;
+  if (doc.containsKey("openHigh")) {
+    bool openHigh = doc["openHigh"] | false;
+    postVendingCommandForApi(VendingCommandType::SET_DOOR_OPEN_LEVEL, -1, openHigh ? 1.0f : 0.0f, "Türsensor-Pegel gespeichert.");
+    return;
+  }
+
+  int slot = doc["slot"] | -1;
+  const char* type = doc["type"] | "none";
+  int pin = doc["pin"] | 0;
+  VendingSnapshot snap = readVendingSnapshot();
+  if (slot < 0 || slot >= snap.activeSlots) { sendApiResult(400, "Invalid slot."); return; }
+
+  uint8_t sensor = DOOR_SENSOR_NONE;
+  if (strcmp(type, "relay") == 0) {
+    if (pin <= snap.activeSlots || pin > relaySlotCount()) { sendApiResult(400, "Relais-Ausgang ist nicht frei."); return; }
+    sensor = (uint8_t)(pin - 1);
+  } else if (strcmp(type, "gpio") == 0) {
+    if (pin < 0 || pin >= DOOR_SENSOR_GPIO || !doorSensorUsable(DOOR_SENSOR_GPIO | pin)) { sendApiResult(400, "GPIO nicht erlaubt."); return; }
+    sensor = DOOR_SENSOR_GPIO | pin;
+  } else if (strcmp(type, "none") != 0) {
+    sendApiResult(400, "Invalid type.");
+    return;
+  }
+  postVendingCommandForApi(VendingCommandType::SET_DOOR_SENSOR, slot, sensor, "Türsensor gespeichert.");
+}
+
+/**
+ * @brief Queues a test message to the configured Telegram chat.
+ */
+void handleApiTelegramTest() {
+  if (!requireApiAuth()) return;
+  String message = "👋 Hallo vom HANIMAT! Dies ist eine Testnachricht. Alles scheint zu funktionieren. Version: " + FIRMWARE_VERSION;
+  sendTelegramMessage(message);
+  sendApiResult(200, nullptr, "Testnachricht in Warteschlange! Überprüfen Sie Ihren Telegram-Chat.");
 }
 
 /**
- * @brief Provides log data as plain text for the web UI.
+ * @brief Provides new log lines as plain text for the web UI.
+ *        Query: after=<sequence> returns only lines written after that cursor (default: all
+ *        buffered lines). The X-Log-Seq header carries the cursor for the next request and
+ *        X-Log-Lost the number of lines that were overwritten before the client fetched them.
+ *        Answers 204 without a body when nothing is new.
  */
 void handleLogDataRequest() {
   lastActivityTimeWeb = millis();
@@ -1588,35 +5622,88 @@ void handleLogDataRequest() {
     return;
   }
 
-  String logContent = "";
-  int startIdx = logIndex;
-  for (int i = 0; i < MAX_LOG_LINES; i++) {
-    int currentReadPos = (startIdx + i) % MAX_LOG_LINES;
-    if (logBuffer[currentReadPos].length() > 0) {
-      logContent += logBuffer[currentReadPos] + "\n";
+  uint32_t after = server.hasArg("after") ? (uint32_t)strtoul(server.arg("after").c_str(), nullptr, 10) : 0;
+
+  String logContent;
+  uint32_t lost = 0;
+  xSemaphoreTake(logMutex, portMAX_DELAY);
+  uint32_t newest = logSequence;
+  if (after > newest) after = 0; // Cursor from before a reboot
+  uint32_t oldest = newest > MAX_LOG_LINES ? newest - MAX_LOG_LINES : 0; // Last overwritten line
+  if (after < oldest) {
+    lost = oldest - after;
+    after = oldest;
+  }
+  uint32_t next = after;
+  if (newest > after) {
+    logContent.reserve((newest - after) * 64);
+    for (uint32_t seq = after + 1; seq <= newest && logContent.length() < LOG_FETCH_MAX_BYTES; seq++) {
+      logContent += logRing[(seq - 1) % MAX_LOG_LINES];
+      logContent += '\n';
+      next = seq;
     }
   }
+  xSemaphoreGive(logMutex);
+
+  server.sendHeader("Cache-Control", "no-store");
+  server.sendHeader("X-Log-Seq", String(next));
+  if (lost > 0) server.sendHeader("X-Log-Lost", String(lost));
+  if (logContent.length() == 0 && lost == 0) {
+    server.send(204, "text/plain", "");
+    return;
+  }
   server.send(200, "text/plain", logContent);
 }
 
-
-// --- OTA Update Handlers ---
-
 /**
- * @brief Displays the OTA update page.
+ * @brief Provides one page of the sales ledger as JSON, newest first.
+ *        Query: before=<sequence> (exclusive, default: newest + 1), count=<n> (max LEDGER_PAGE_MAX).
  */
-void handleOTAUpdatePage() {
+void handleSalesDataRequest() {
+  lastActivityTimeWeb = millis();
   if (!isAuthenticated) {
-    server.sendHeader("Location", "/login", true);
-    server.send(302, "text/plain", "");
+    server.send(401, "text/plain", "Not authorized.");
     return;
   }
-  lastActivityTimeWeb = millis();
-  // The actual HTML is generated by showDashboard() JS, this just redirects.
-  server.sendHeader("Location", "/#ota-update-section", true);
-  server.send(302, "text/plain", "");
+
+  uint32_t newest = ledgerNewestSequence;
+  uint32_t before = server.hasArg("before") ? (uint32_t)server.arg("before").toInt() : newest + 1;
+  if (before > newest + 1) before = newest + 1;
+  int count = server.hasArg("count") ? server.arg("count").toInt() : 20;
+  if (count <= 0 || count > LEDGER_PAGE_MAX) count = LEDGER_PAGE_MAX;
+
+  String json;
+  json.reserve(96 + count * 150);
+  char buffer[192];
+  snprintf(buffer, sizeof(buffer), "{\"newest\":%u,\"dropped\":%u,\"records\":[", (unsigned)newest, (unsigned)ledgerDropped);
+  json += buffer;
+
+  LedgerRecord record;
+  uint32_t next = 0; // Cursor for the following page, 0 = no more records
+  int emitted = 0;
+  for (uint32_t seq = before - 1; seq >= 1 && emitted < count; seq--) {
+    if (!readLedgerRecord(seq, record)) break; // Older records were overwritten
+    snprintf(buffer, sizeof(buffer),
+             "%s{\"seq\":%u,\"time\":%u,\"tv\":%d,\"slot\":%u,\"price\":%u,\"before\":%d,\"after\":%d,\"coins\":%u,\"bills\":%u,\"manual\":%d,\"card\":%d,\"doorFail\":%d}",
+             emitted > 0 ? "," : "", (unsigned)record.sequence, (unsigned)record.timestamp,
+             (record.flags & LEDGER_FLAG_TIME_VALID) ? 1 : 0, (unsigned)record.slot + 1, (unsigned)record.priceCents,
+             (int)record.creditBeforeCents, (int)record.creditAfterCents, (unsigned)record.coinCents,
+             (unsigned)record.billEuros, (int)record.manualCents,
+             (record.flags & LEDGER_FLAG_CASHLESS) ? (int)record.priceCents - (record.creditBeforeCents - record.creditAfterCents) : 0,
+             (record.flags & LEDGER_FLAG_DOOR_UNCONFIRMED) ? 1 : 0);
+    json += buffer;
+    emitted++;
+    next = seq;
+  }
+  if (next <= 1) next = 0;
+  snprintf(buffer, sizeof(buffer), "],\"next\":%u}", (unsigned)next);
+  json += buffer;
+  server.send(200, "application/json", json);
 }
 
+
+// --- OTA Update Handlers ---
+
 /**
  * @brief Handles the binary file upload for OTA updates.
  */
@@ -1628,21 +5715,21 @@ void handleOTAFileUpload() {
   if (upload.status == UPLOAD_FILE_START) {
     otaUpdateInProgress = true;
     otaStatusMessage = "Upload started... Writing firmware.";
-    logMessage("OTA: Upload started: " + upload.filename);
-    displayOTAMessageTFT("Update gestartet", "Nicht ausschalten!", "", ILI9341_ORANGE);
+    LOG_INFO("OTA: Upload started: %s", upload.filename.c_str());
+    postTftMessage("Update gestartet", "Nicht ausschalten!", "", ILI9341_ORANGE);
     if (!Update.begin(UPDATE_SIZE_UNKNOWN)) {
       Update.printError(Serial);
-      logMessage("OTA ERROR: Update.begin() failed. Error: " + String(Update.getError()));
+      LOG_ERROR("OTA: Update.begin() failed. Error: %u", Update.getError());
       otaStatusMessage = "ERROR: Could not start update (Error: " + String(Update.getError()) + ")";
-      displayOTAMessageTFT("Update Fehler!", "Start fehlgeschlagen", "Details im Log", ILI9341_RED);
+      postTftMessage("Update Fehler!", "Start fehlgeschlagen", "Details im Log", ILI9341_RED);
       otaUpdateInProgress = false;
     }
   } else if (upload.status == UPLOAD_FILE_WRITE) {
     if (Update.write(upload.buf, upload.currentSize) != upload.currentSize) {
       Update.printError(Serial);
-      logMessage("OTA ERROR: Update.write() failed. Error: " + String(Update.getError()));
+      LOG_ERROR("OTA: Update.write() failed. Error: %u", Update.getError());
       otaStatusMessage = "ERROR: Failed to write firmware (Error: " + String(Update.getError()) + ")";
-      displayOTAMessageTFT("Update Fehler!", "Schreibfehler", "Details im Log", ILI9341_RED);
+      postTftMessage("Update Fehler!", "Schreibfehler", "Details im Log", ILI9341_RED);
       otaUpdateInProgress = false;
       Update.end(false);
     }
@@ -1650,147 +5737,32 @@ void handleOTAFileUpload() {
     if (otaUpdateInProgress) {
         if (Update.end(true)) {
             otaStatusMessage = "Update successful! ESP32 is restarting...";
-            logMessage("OTA: Update finished successfully. Restarting ESP32.");
-            displayOTAMessageTFT("Update fertig.", "Automat startet neu", "", ILI9341_GREEN);
-            server.sendHeader("Location", "/otaupdate", true);
-            server.send(302, "text/plain", "Update successful, restarting...");
+            postVendingCommand(VendingCommandType::FLUSH_SETTINGS);
+            LOG_INFO("OTA: Update finished successfully. Restarting ESP32.");
+            postTftMessage("Update fertig.", "Automat startet neu", "", ILI9341_GREEN);
+            sendApiResult(200, nullptr, "Update erfolgreich, Automat startet neu.");
             delay(3000);
             ESP.restart();
         } else {
             Update.printError(Serial);
-            logMessage("OTA ERROR: Update.end() failed. Error: " + String(Update.getError()));
+            LOG_ERROR("OTA: Update.end() failed. Error: %u", Update.getError());
             otaStatusMessage = "ERROR: Update failed (Error: " + String(Update.getError()) + ")";
-            displayOTAMessageTFT("Update Fehler!", "Abschluss fehlgeschl.", "Details im Log", ILI9341_RED);
+            postTftMessage("Update Fehler!", "Abschluss fehlgeschl.", "Details im Log", ILI9341_RED);
         }
     }
     otaUpdateInProgress = false;
   } else if (upload.status == UPLOAD_FILE_ABORTED) {
-      logMessage("OTA: Upload aborted by client.");
+      LOG_INFO("OTA: Upload aborted by client.");
       if(otaUpdateInProgress) Update.end(false);
       otaUpdateInProgress = false;
   }
 }
 
-/**
- * @brief Handles timing configuration form submission.
- */
-void handleSaveTimingConfig() {
-    if (!isAuthenticated) { server.send(401, "text/plain", "Not authorized."); return; }
-    lastActivityTimeWeb = millis();
-
-    preferences.begin("hanimat", false);
-    preferences.putULong("coinDelay", server.arg("coin_delay").toInt());
-    preferences.putULong("billIsrDeb", server.arg("bill_isr_debounce").toInt());
-    preferences.putULong("billGrpTout", server.arg("bill_group_timeout").toInt());
-    preferences.putULong("dispTime", server.arg("disp_time").toInt());
-    preferences.putULong("keypadTime", server.arg("keypad_time").toInt());
-    preferences.putULong("slotSelTime", server.arg("slot_sel_time").toInt());
-    preferences.putULong("dispTimeout", server.arg("disp_timeout").toInt());
-    preferences.end();
-    
-    logMessage("Web: Timing settings saved. A restart is recommended.");
-    otaStatusMessage = "Zeiteinstellungen gespeichert! Neustart empfohlen.";
-    server.sendHeader("Location", "/#timing-config", true);
-    server.send(302, "text/plain", "");
-}
-
-/**
- * @brief Handles Telegram and stock notification form submission.
- */
-void handleSaveTelegramConfig() {
-    if (!isAuthenticated) { server.send(401, "text/plain", "Not authorized."); return; }
-    lastActivityTimeWeb = millis();
-
-    telegramEnabled = server.hasArg("tg_enabled");
-    telegramNotifyOnSale = server.hasArg("notify_sale");
-    telegramNotifyAlmostEmpty = server.hasArg("notify_almost_empty");
-    telegramNotifyEmpty = server.hasArg("notify_empty");
-    telegramBotToken = server.arg("tg_token");
-    telegramChatId = server.arg("tg_chat_id");
-    almostEmptyThreshold = server.arg("almost_empty_threshold").toInt();
-
-    preferences.begin("hanimat", false);
-    preferences.putBool("tgEnabled", telegramEnabled);
-    preferences.putString("tgToken", telegramBotToken);
-    preferences.putString("tgChatId", telegramChatId);
-    preferences.putInt("tgAlmostThres", almostEmptyThreshold);
-    preferences.putBool("tgNotifySale", telegramNotifyOnSale);
-    preferences.putBool("tgNotifyAlmost", telegramNotifyAlmostEmpty);
-    preferences.putBool("tgNotifyEmpty", telegramNotifyEmpty);
-    preferences.end();
-
-    bot.updateToken(telegramBotToken);
-
-    logMessage("Web: Telegram & notification settings saved.");
-    otaStatusMessage = "Einstellungen gespeichert!";
-    server.sendHeader("Location", "/#telegram-config", true);
-    server.send(302, "text/plain", "");
-}
-
-/**
- * @brief Sends a test message to the configured Telegram chat.
- */
-void handleSendTestTelegram() {
-    if (!isAuthenticated) { server.send(401, "text/plain", "Not authorized."); return; }
-    lastActivityTimeWeb = millis();
-    String message = "👋 Hallo vom HANIMAT! Dies ist eine Testnachricht. Alles scheint zu funktionieren. Version: " + FIRMWARE_VERSION;
-    sendTelegramMessage(message);
-    otaStatusMessage = "Testnachricht gesendet! Überprüfen Sie Ihren Telegram-Chat.";
-    server.sendHeader("Location", "/#telegram-config", true);
-    server.send(302, "text/plain", "");
-}
-
-void handleDisplayConfigPage() {
-  server.sendHeader("Location", "/#display-config", true);
-  server.send(302);
-}
-
-void handleSaveDisplayConfig() {
-  if (!isAuthenticated) { server.send(401); return; }
-
-  // Slogan-Text holen und auf maximale Länge kürzen
-  String newSlogan = server.arg("slogan");
-  if (newSlogan.length() > SLOGAN_MAX_LENGTH) {
-    newSlogan = newSlogan.substring(0, SLOGAN_MAX_LENGTH);
-  }
-
-  // Footer-Text holen und ebenfalls kürzen (sicherheitshalber)
-  String newFooter = server.arg("footer");
-  if (newFooter.length() > 30) { // Limit für Footer
-    newFooter = newFooter.substring(0, 30);
-  }
-
-  // Globale Variablen aktualisieren
-  displaySlogan = newSlogan;
-  displayFooter = newFooter;
-
-  // Im Speicher sichern
-  preferences.begin("hanimat", false);
-  preferences.putString("dispSlogan", displaySlogan);
-  preferences.putString("dispFooter", displayFooter);
-  preferences.end();
-  displayNeedsUpdate = true; 
-   
-  logMessage("Web: Display texts updated.");
-  otaStatusMessage = "Display-Texte gespeichert!";
-  server.sendHeader("Location", "/#display-config", true);
-  server.send(302);
-}
-
-// Redirects for settings pages (content is loaded via JS)
-void handleTimingConfigPage() { server.sendHeader("Location", "/#timing-config", true); server.send(302); }
-void handleTelegramConfigPage() { server.sendHeader("Location", "/#telegram-config", true); server.send(302); }
-
-
 // =================================================================
 //                      HTML PAGE GENERATORS
 // =================================================================
 
-/**
- * @brief Generates and sends the HTML for the login page.
- */
-void showLoginPage() {
-  String html = R"HTML(
+static const char LOGIN_PAGE_HTML[] PROGMEM = R"HTML(
 <!DOCTYPE html><html><head><title>Login | HANIMAT</title><meta charset='UTF-8'><meta name='viewport' content='width=device-width, initial-scale=1.0'>
 <style>
 :root { --primary: #FFA500; --primary-hover: #FF8C00; --background: #1E1E1E; --text: #E0E0E0; --card-bg: #2D2D2D; }
@@ -1814,214 +5786,28 @@ button:hover { background: var(--primary-hover); }
 </div>
 </body></html>
 )HTML";
-  server.send(200, "text/html", html);
-}
 
 /**
- * @brief Generates and sends the main dashboard HTML page (Single Page Application).
+ * @brief Sends the HTML for the login page.
  */
-void showDashboard() {
-  String html = R"HTML(
-<!DOCTYPE html><html lang='de'><head><title>Admin Panel | HANIMAT</title><meta charset='UTF-8'><meta name='viewport' content='width=device-width, initial-scale=1.0'>
-<style>
-:root { --primary: #FFA500; --primary-hover: #FF8C00; --background: #121212; --text: #E0E0E0; --card-bg: #1E1E1E; --sidebar-bg: #1A1A1A; --sidebar-width: 260px; --border-color: #333; --input-bg: #2C2C2C; --success: #4CAF50; --error: #F44336; --info: #2196F3;}
-* { box-sizing: border-box; margin: 0; padding: 0; }
-body { font-family: 'Inter', system-ui, sans-serif; background: var(--background); color: var(--text); display: flex; min-height: 100vh; font-size: 14px; }
-.sidebar { width: var(--sidebar-width); background: var(--sidebar-bg); padding: 1.5rem 1rem; border-right: 1px solid var(--border-color); position: fixed; height: 100vh; overflow-y: auto; transition: transform 0.3s ease; z-index: 1000;}
-.main-content { flex: 1; margin-left: var(--sidebar-width); padding: 1.5rem; transition: margin-left 0.3s ease; }
-.logo { font-size: 1.8rem; font-weight: 700; color: var(--primary); margin-bottom: 2rem; text-align: center; }
-.nav-menu { list-style: none; }
-.nav-item { margin-bottom: 0.5rem; }
-.nav-link { display: flex; align-items: center; gap: 0.8rem; padding: 0.8rem 1rem; border-radius: 0.5rem; color: #ccc; text-decoration: none; transition: all 0.2s ease; font-weight: 500; }
-.nav-link:hover, .nav-link.active { background: var(--primary); color: var(--background); }
-.card { background: var(--card-bg); border-radius: 1rem; padding: 1.5rem; box-shadow: 0 6px 12px rgba(0,0,0,0.3); margin-bottom: 1.5rem; }
-h1, h2 { color: var(--primary); margin-bottom: 1rem; font-weight: 600; } h1 { font-size: 1.8rem; } h2 { font-size: 1.5rem; }
-.grid { display: grid; grid-template-columns: repeat(auto-fit, minmax(220px, 1fr)); gap: 1.5rem; }
-.stat-card { background: var(--input-bg); padding: 1.5rem; border-radius: 0.75rem; text-align: center; }
-.stat-label { font-size: 0.9rem; color: #aaa; margin-bottom: 0.5rem; }
-.stat-value { font-size: 2rem; font-weight: 700; color: var(--primary); }
-table { width: 100%; border-collapse: collapse; background: var(--card-bg); border-radius: 0.75rem; overflow: hidden; }
-th, td { padding: 0.9rem 1rem; text-align: left; border-bottom: 1px solid var(--border-color); }
-th { background: var(--input-bg); font-weight: 600; }
-tr:hover { background: #252525; }
-.btn { display: inline-flex; align-items: center; justify-content: center; gap: 0.5rem; padding: 0.7rem 1.2rem; border-radius: 0.5rem; text-decoration: none; transition: all 0.2s ease; border: none; cursor: pointer; font-weight: 500; white-space: nowrap;}
-.btn-primary { background: var(--primary); color: var(--background); } .btn-primary:hover { background: var(--primary-hover); }
-.btn-secondary { background: var(--input-bg); color: var(--text); border: 1px solid var(--border-color); } .btn-secondary:hover { background: #383838; }
-.btn-danger { background: var(--error); color: white; } .btn-danger:hover { background: #D32F2F; }
-.btn-icon { padding: 0.6rem; background: transparent; border: 1px solid var(--border-color); color: #ccc; } .btn-icon:hover { background: var(--input-bg); color: var(--primary); }
-.badge { padding: 0.3rem 0.6rem; border-radius: 0.3rem; font-size: 0.8rem; font-weight: 500; }
-.locked-badge { background: var(--error); color: white; } .available-badge { background: #64B5F6; color: white; } .empty-badge { background: #757575; color: white; } .success-badge { background: var(--success); color: white; }
-input[type='text'], input[type='number'], input[type='password'], select { width: 100%; padding: 0.8rem; border: 1px solid var(--border-color); border-radius: 0.5rem; font-size: 0.9rem; background: var(--input-bg); color: var(--text); }
-.form-group { margin-bottom: 1.2rem; } .form-group label { display: block; margin-bottom: 0.4rem; font-weight: 500; }
-.form-inline { display: flex; gap: 0.8rem; align-items: flex-end; } .form-inline input, .form-inline select { flex: 1; }
-#log-console { background: #000; color: #0F0; padding: 1rem; height: 250px; overflow-y: auto; border-radius: 0.5rem; font-family: 'Courier New', monospace; white-space: pre-wrap; }
-.mobile-header { display: none; }
-.sidebar-footer { margin-top: auto; padding-top: 1rem; border-top: 1px solid var(--border-color); font-size: 0.8rem; color: #888; text-align: center;}
-.status-message { padding: 1rem; border-radius: 0.5rem; margin-top: 1rem; text-align: center; font-weight: 500;}
-.status-success { background-color: var(--success); color: white;} .status-error { background-color: var(--error); color: white;} .status-info { background-color: var(--info); color: white;}
-.checkbox-label { display: flex; align-items: center; gap: 0.5rem; cursor: pointer; } .checkbox-label input { width: auto; }
-@media (max-width: 768px) {
-  .sidebar { transform: translateX(-100%); width: 80%; max-width: 300px; }
-  .sidebar.active { transform: translateX(0); }
-  .main-content { margin-left: 0; padding-top: 5rem; }
-  .mobile-header { display: flex; justify-content: space-between; align-items: center; position: fixed; top: 0; left: 0; width: 100%; background: var(--sidebar-bg); padding: 0.8rem 1rem; z-index: 1002; }
-  .menu-toggle { background: none; border: none; color: var(--primary); font-size: 1.8rem; cursor: pointer; }
-  .form-inline { flex-direction: column; align-items: stretch; }
-  table { display: block; overflow-x: auto; white-space: nowrap; }
+void showLoginPage() {
+  server.send_P(200, "text/html", LOGIN_PAGE_HTML);
 }
-</style></head><body>
-<div class='mobile-header'><div class='logo'>HANIMAT</div><button class='menu-toggle' onclick='toggleSidebar()'>&#9776;</button></div>
-<aside class='sidebar'>
-  <div class='logo'>HANIMAT</div>
-  <ul class='nav-menu'>
-    <li class='nav-item'><a href='javascript:void(0)' class='nav-link active' onclick='showSection("dashboard")'>Dashboard</a></li>
-    <li class='nav-item'><a href='javascript:void(0)' class='nav-link' onclick='showSection("slots-config")'>Slotkonfiguration</a></li>
-    <li class='nav-item'><a href='javascript:void(0)' class='nav-link' onclick='showSection("display-config")'>Anzeige</a></li>
-    <li class='nav-item'><a href='javascript:void(0)' class='nav-link' onclick='showSection("timing-config")'>Zeiteinstellungen</a></li>
-    <li class='nav-item'><a href='javascript:void(0)' class='nav-link' onclick='showSection("telegram-config")'>Benachrichtigungen</a></li>
-    <li class='nav-item'><a href='javascript:void(0)' class='nav-link' onclick='showSection("network-config")'>Netzwerk</a></li>
-    <li class='nav-item'><a href='javascript:void(0)' class='nav-link' onclick='showSection("password-config")'>Passwort</a></li>
-    <li class='nav-item'><a href='javascript:void(0)' class='nav-link' onclick='showSection("logs")'>Logs</a></li>
-    <li class='nav-item'><a href='javascript:void(0)' class='nav-link' onclick='showSection("ota-update-section")'>System Update</a></li>
-  </ul>
-  <div class='sidebar-footer'>Version: 
-)HTML";
-  html += FIRMWARE_VERSION;
-  html += R"HTML(<br><a href='http://www.hanimat.at' target='_blank'>www.hanimat.at</a></div></aside>
-<main class='main-content'>
-  <!-- Dashboard Section -->
-  <section id='dashboard' class='content-section'><h1>Dashboard</h1><div class='grid'>
-    <div class='stat-card'><div class='stat-label'>Verfügbare Fächer</div><div class='stat-value'>)HTML";
-  html += String(countAvailableSlots()) + "/" + String(activeSlots) + "</div></div>";
-  html += "<div class='stat-card'><div class='stat-label'>Aktuelles Guthaben</div><div class='stat-value'>" + String(credit, 2) + " &euro;</div></div>";
-  html += "<div class='stat-card'><div class='stat-label'>System Uptime</div><div class='stat-value'>" + String(millis()/60000) + " min</div></div></div>";
-  html += R"HTML(
-    <div class='card' style='margin-top: 1.5rem;'><h2>Schnellaktionen</h2>
-      <div class='form-inline' style='margin-bottom: 1.5rem;'>
-        <form action='/addcredit' method='post' class='form-inline' style='flex-grow: 1;'><div class='form-group' style='margin-bottom:0; flex-grow: 1;'><label for='addAmount'>Guthaben +/-</label><input type='number' step='0.01' id='addAmount' name='amount' placeholder='Betrag' required></div><button type='submit' class='btn btn-primary'>OK</button></form>
-        <form action='/resetcredit' method='post'><button type='submit' class='btn btn-danger'>Guthaben Reset</button></form>
-      </div>
-      <div class='form-inline' style='gap:1rem;'><form action='/refillall' method='post' style='flex:1;'><button type='submit' class='btn btn-secondary' style='width:100%;'>Alle Fächer auffüllen</button></form><form action='/triggerallrelays' method='post' style='flex:1;'><button type='submit' class='btn btn-secondary' style='width:100%;'>Alle Relais testen</button></form></div>
-    </div>
-    <h2>Fachübersicht</h2><table><thead><tr><th>Fach</th><th>Status</th><th>Preis (&euro;)</th><th>Aktionen</th></tr></thead><tbody>
-)HTML";
-  for (int i = 0; i < activeSlots; i++) {
-    String statusText, statusClass;
-    if (slotLocked[i]) { statusText = "Gesperrt"; statusClass = "locked-badge"; }
-    else if (!slotAvailable[i]) { statusText = "Leer"; statusClass = "empty-badge"; }
-    else { statusText = "Verfügbar"; statusClass = "success-badge"; }
-    html += "<tr><td>#" + String(i+1) + "</td><td><span class='badge " + statusClass + "'>" + statusText + "</span></td><td>" + String(slotPrices[i], 2) + "</td><td><div class='form-inline' style='gap:0.3rem;'>";
-    html += "<form action='/toggleslotlock' method='post'><input type='hidden' name='slot' value='" + String(i) + "'><button type='submit' class='btn btn-icon' title='" + (slotLocked[i] ? "Entsperren" : "Sperren") + "'>" + (slotLocked[i] ? "&#128274;" : "&#128275;") + "</button></form>";
-    html += "<form action='/triggerrelay' method='post'><input type='hidden' name='slot' value='" + String(i) + "'><button type='submit' class='btn btn-icon' title='Test Relais'>&#9889;</button></form>";
-    html += "<form action='/refill' method='post'><input type='hidden' name='slot' value='" + String(i) + "'><button type='submit' class='btn btn-icon' title='Auffüllen'>&#128260;</button></form></div></td></tr>";
-  }
-  html += "</tbody></table></section>";
-
-  html += R"HTML(
-  <!-- Slots Config Section -->
-  <section id='slots-config' class='content-section' style='display:none;'><h1>Slotkonfiguration</h1>
-    <div class='card'><form action='/updateslots' method='post'><div class='form-group'><label for='maxSlotsInput'>Anzahl aktiver Fächer (1-)HTML";
-  html += String(MAX_SLOTS) + R"HTML(:</label><input type='number' id='maxSlotsInput' name='maxSlots' value=')HTML" + String(activeSlots) + R"HTML(' min='1' max=')HTML" + String(MAX_SLOTS) + R"HTML(' required></div><button type='submit' class='btn btn-primary'>Speichern</button></form></div>
-    <h2>Preise anpassen</h2><div class='grid'>
-)HTML";
-  for (int i = 0; i < activeSlots; i++) {
-    html += "<div class='card'><form action='/updateprice' method='post'><div class='form-group'><label for='price" + String(i) + "'>Fach #" + String(i+1) + " Preis (&euro;)</label><input type='hidden' name='slot' value='" + String(i) + "'><input type='number' step='0.01' id='price" + String(i) + "' name='price' value='" + String(slotPrices[i],2) + "' required></div><button type='submit' class='btn btn-primary'>Preis Speichern</button></form></div>";
-  }
-  html += "</div></section>";
-
-// Display Config Section
-  html += R"HTML(<section id='display-config' class='content-section' style='display:none;'><h1>Anzeige anpassen</h1><div class='card'>
-    <h2>Footer-Texte</h2>
-    <form action='/savedisplayconfig' method='post'>
-      <div class='form-group'>
-        <label for='slogan_input'>Slogan (über dem Footer, max. )HTML" + String(SLOGAN_MAX_LENGTH) + R"HTML( Zeichen):</label>
-        <input type='text' id='slogan_input' name='slogan' value=')HTML" + displaySlogan + R"HTML(' maxlength=')HTML" + String(SLOGAN_MAX_LENGTH) + R"HTML('>
-      </div>
-      <div class='form-group'>
-        <label for='footer_input'>Footer-Text (unterste Zeile, max. 30 Zeichen):</label>
-        <input type='text' id='footer_input' name='footer' value=')HTML" + displayFooter + R"HTML(' maxlength='30' required>
-      </div>
-      <button type='submit' class='btn btn-primary'>Speichern</button>
-    </form>
-  </div></section>)HTML";
-
-  // Timing Config Section
-  html += R"HTML(<section id='timing-config' class='content-section' style='display:none;'><h1>Zeiteinstellungen</h1><div class='card'><form action='/savetimingconfig' method='post'>)HTML";
-  html += "<div class='form-group'><label for='coin_delay'>Münzverarbeitung Verzoegerung (ms):</label><input type='number' id='coin_delay' name='coin_delay' value='" + String(COIN_PROCESSING_DELAY) + "' required></div>";
-  html += "<div class='form-group'><label for='bill_isr_debounce'>Schein ISR Entprellzeit (ms):</label><input type='number' id='bill_isr_debounce' name='bill_isr_debounce' value='" + String(BILL_ISR_DEBOUNCE_MS) + "' required></div>";
-  html += "<div class='form-group'><label for='bill_group_timeout'>Schein Gruppen Timeout (ms):</label><input type='number' id='bill_group_timeout' name='bill_group_timeout' value='" + String(BILL_GROUP_PROCESSING_TIMEOUT_MS) + "' required></div>";
-  html += "<div class='form-group'><label for='disp_time'>Fach Oeffnungszeit (ms):</label><input type='number' id='disp_time' name='disp_time' value='" + String(DISPENSE_RELAY_ON_TIME) + "' required></div>";
-  html += "<div class='form-group'><label for='keypad_time'>Keypad Eingabe Timeout (ms):</label><input type='number' id='keypad_time' name='keypad_time' value='" + String(KEYPAD_INPUT_TIMEOUT) + "' required></div>";
-  html += "<div class='form-group'><label for='slot_sel_time'>Fachauswahl Anzeige Timeout (ms):</label><input type='number' id='slot_sel_time' name='slot_sel_time' value='" + String(SLOT_SELECTION_TIMEOUT) + "' required></div>";
-  html += "<div class='form-group'><label for='disp_timeout'>Display Timeout (ms):</label><input type='number' id='disp_timeout' name='disp_timeout' value='" + String(DISPLAY_TIMEOUT) + "' required></div>";
-  html += R"HTML(<button type='submit' class='btn btn-primary'>Zeiten Speichern</button></form></div></section>)HTML";
-
-  // Telegram Config Section
-  html += R"HTML(<section id='telegram-config' class='content-section' style='display:none;'><h1>Benachrichtigungen</h1><div class='card'><form action='/savetelegramconfig' method='post'>)HTML";
-  html += "<h2>Telegram Konfiguration</h2>";
-  html += String("<div class='form-group'><label class='checkbox-label'><input type='checkbox' name='tg_enabled' ") + (telegramEnabled ? "checked" : "") + "> <b>Telegram-Benachrichtigungen aktivieren</b></label></div>";
-  html += "<div class='form-group'><label for='tg_token'>Bot Token:</label><input type='password' id='tg_token' name='tg_token' value='" + telegramBotToken + "'></div>";
-  html += "<div class='form-group'><label for='tg_chat_id'>Chat ID:</label><input type='text' id='tg_chat_id' name='tg_chat_id' value='" + telegramChatId + "'></div>";
-  html += "<h2>Benachrichtigungs-Optionen</h2>";
-  html += String("<div class='form-group'><label class='checkbox-label'><input type='checkbox' name='notify_sale' ") + (telegramNotifyOnSale ? "checked" : "") + "> Bei jedem Verkauf benachrichtigen</label></div>";
-  html += String("<div class='form-group'><label class='checkbox-label'><input type='checkbox' name='notify_almost_empty' ") + (telegramNotifyAlmostEmpty ? "checked" : "") + "> Benachrichtigen, wenn Automat fast leer ist</label></div>";
-  html += "<div class='form-group'><label for='almost_empty_threshold'>\"Fast leer\" Schwelle (Anzahl Fächer):</label><input type='number' id='almost_empty_threshold' name='almost_empty_threshold' value='" + String(almostEmptyThreshold) + "' required></div>";
-  html += String("<div class='form-group'><label class='checkbox-label'><input type='checkbox' name='notify_empty' ") + (telegramNotifyEmpty ? "checked" : "") + "> Benachrichtigen, wenn Automat komplett leer ist</label></div>";
-  html += R"HTML(<button type='submit' class='btn btn-primary'>Speichern</button></form><form action='/sendtesttelegram' method='post' style='margin-top: 1rem;'><button type='submit' class='btn btn-secondary'>Testnachricht senden</button></form></div></section>)HTML";
-
-  // Network Config Section
-  preferences.begin("hanimat", false);
-  String staticIP_val = preferences.getString("static_ip", "");
-  String gateway_val = preferences.getString("gateway", "");
-  String subnet_val = preferences.getString("subnet", "");
-  String dns1_val = preferences.getString("dns1", "8.8.8.8");
-  preferences.end();
-  html += R"HTML(<section id='network-config' class='content-section' style='display:none;'><h1>Netzwerkeinstellungen</h1><div class='card'>)HTML";
-  html += "<p>Aktuelle IP: " + WiFi.localIP().toString() + "</p>";
-  html += String("<p>Modus: ") + (staticIP_val.length() > 0 ? "Statische IP" : "DHCP") + "</p>";
-  html += R"HTML(<form action='/setstaticip' method='post'>)HTML";
-  html += "<div class='form-group'><label for='static_ip_input'>Statische IP (leer für DHCP):</label><input type='text' id='static_ip_input' name='static_ip' value='" + staticIP_val + "'></div>";
-  html += "<div class='form-group'><label for='gateway_input'>Gateway:</label><input type='text' id='gateway_input' name='gateway' value='" + gateway_val + "'></div>";
-  html += "<div class='form-group'><label for='subnet_input'>Subnetzmaske:</label><input type='text' id='subnet_input' name='subnet' value='" + subnet_val + "'></div>";
-  html += "<div class='form-group'><label for='dns1_input'>DNS 1 (optional):</label><input type='text' id='dns1_input' name='dns1' value='" + dns1_val + "'></div>";
-  html += R"HTML(<button type='submit' class='btn btn-primary'>Speichern & Neustart</button></form></div></section>)HTML";
-   
-  // Password Config Section
-  html += R"HTML(<section id='password-config' class='content-section' style='display:none;'><h1>Passwort ändern</h1><div class='card'><form action='/changepassword' method='post'><div class='form-group'><label for='newPasswordInput'>Neues Passwort (min. 4 Zeichen):</label><input type='password' id='newPasswordInput' name='newPassword' required></div><button type='submit' class='btn btn-primary'>Passwort Speichern</button></form></div></section>)HTML";
-
-  // Logs Section
-  html += R"HTML(<section id='logs' class='content-section' style='display:none;'><h1>Live Logs</h1><div class='card'><div id='log-console'>Lade Logs...</div></div></section>)HTML";
-
-  // OTA Update Section
-  html += R"HTML(<section id='ota-update-section' class='content-section' style='display:none;'><h1>System Update (OTA)</h1><div class='card'><h2>Firmware hochladen (.bin Datei)</h2><form method='POST' action='/ota-upload' enctype='multipart/form-data'><input type='file' name='update' accept='.bin' required><br><br><button type='submit' class='btn btn-primary'>Update starten</button></form></div></section>)HTML";
-
-  html += R"HTML(
-</main>
-<script>
-function toggleSidebar() { document.querySelector('.sidebar').classList.toggle('active'); }
-function showSection(sectionId) {
-  document.querySelectorAll('.content-section').forEach(s => s.style.display = 'none');
-  const targetSection = document.getElementById(sectionId);
-  if (targetSection) { targetSection.style.display = 'block'; }
-  document.querySelectorAll('.nav-link').forEach(l => l.classList.remove('active'));
-  let activeLink = document.querySelector(`.nav-link[onclick*='showSection("${sectionId}")']`);
-  if(activeLink) activeLink.classList.add('active');
-  if (window.innerWidth <= 768 && document.querySelector('.sidebar').classList.contains('active')) { toggleSidebar(); }
-  if (sectionId === 'logs') { fetchLogs(); }
-}
-function fetchLogs(){
-  const logConsole = document.getElementById('log-console');
-  if (!logConsole) return;
-  fetch('/logdata').then(r => r.text()).then(t => { logConsole.textContent = t; logConsole.scrollTop = logConsole.scrollHeight; });
-}
-document.addEventListener('DOMContentLoaded', () => {
-  const hash = window.location.hash.substring(1);
-  if (hash && document.getElementById(hash)) { showSection(hash); } else { showSection('dashboard'); }
-  if(document.getElementById('log-console')) { setInterval(fetchLogs, 3000); }
-});
-</script></body></html>
-)HTML";
-  server.send(200, "text/html; charset=UTF-8", html);
+
+/**
+ * @brief Sends the admin app (a gzipped single page application from flash). Browsers
+ *        revalidate with If-None-Match and get a bodyless 304 while the firmware is unchanged.
+ *        All data is loaded through the /api endpoints.
+ */
+void showAdminApp() {
+  server.sendHeader("ETag", ADMIN_APP_ETAG);
+  server.sendHeader("Cache-Control", "no-cache");
+  if (server.header("If-None-Match") == ADMIN_APP_ETAG) {
+    server.send(304);
+    return;
+  }
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, "text/html; charset=UTF-8", (const char*)ADMIN_APP_GZ, ADMIN_APP_GZ_LEN);
 }
 
 
@@ -2041,6 +5827,19 @@ int countAvailableSlots() {
   return count;
 }
 
+/**
+ * @brief Counts the available and unlocked slots in a published snapshot (for the web UI).
+ * @param snap The snapshot to evaluate.
+ * @return The count of available slots.
+ */
+int countAvailableSlots(const VendingSnapshot& snap) {
+  int count = 0;
+  for (int i = 0; i < snap.activeSlots; i++) {
+    if (snap.slotAvailable[i] && !snap.slotLocked[i]) count++;
+  }
+  return count;
+}
+
 /**
  * @brief Counts the number of slots that are empty and not locked.
  * @return The count of empty slots.
@@ -2078,7 +5877,7 @@ void checkOverallStockLevel() {
     // Reset flags if stock is high again
     else if (totalAvailable > almostEmptyThreshold) {
         if(almostEmptyNotificationSent || emptyNotificationSent) {
-            logMessage("Stock level is high again. Resetting notification flags.");
+            LOG_INFO("Stock level is high again. Resetting notification flags.");
         }
         almostEmptyNotificationSent = false;
         emptyNotificationSent = false;
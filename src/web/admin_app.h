@@ -0,0 +1,611 @@
+// Generated by tools/embed_web.py from web/index.html - do not edit.
+#pragma once
+
+#define ADMIN_APP_ETAG "\"19dbcbc1\""
+#define ADMIN_APP_GZ_LEN 9634
+
+static const uint8_t ADMIN_APP_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x3d, 0xdb, 0x76, 0xdb, 0x38,
+  0x92, 0xef, 0xfe, 0x0a, 0xe4, 0xb2, 0x21, 0x39, 0x6d, 0xc9, 0x92, 0x1d, 0xa7, 0xd3, 0x96, 0xad,
+  0x5e, 0xe7, 0xe2, 0xb4, 0xa7, 0x93, 0x4e, 0xce, 0xd8, 0x33, 0xbd, 0xbb, 0x5e, 0x9f, 0x98, 0x12,
+  0x21, 0x89, 0x6d, 0x8a, 0xd4, 0x90, 0x94, 0x15, 0xc7, 0xa3, 0x7d, 0xda, 0x6f, 0xd8, 0xb3, 0x0f,
+  0xfb, 0xd8, 0xdf, 0x30, 0x4f, 0xfd, 0xe6, 0x1f, 0xdb, 0xaa, 0xc2, 0x85, 0x00, 0x49, 0xc9, 0x92,
+  0x3b, 0x93, 0xdd, 0xe3, 0x93, 0x98, 0x04, 0x81, 0x42, 0xa1, 0x50, 0xa8, 0x1b, 0x0a, 0xf0, 0xfe,
+  0x83, 0x57, 0xef, 0x5f, 0x9e, 0xfe, 0xeb, 0x87, 0xd7, 0x6c, 0x94, 0x8f, 0xa3, 0xee, 0x3e, 0xfe,
+  0xcf, 0x22, 0x3f, 0x1e, 0x1e, 0x38, 0x01, 0x77, 0xe0, 0x9d, 0xfb, 0x41, 0x77, 0x3f, 0x0f, 0xf3,
+  0x88, 0x77, 0x0f, 0x83, 0x71, 0x18, 0xb3, 0x0f, 0x7e, 0xcc, 0x23, 0xf6, 0x37, 0xf6, 0xc3, 0xe1,
+  0x4f, 0xc7, 0xef, 0x0e, 0x4f, 0xf7, 0xb7, 0xc4, 0xc7, 0xfd, 0x31, 0xcf, 0x7d, 0xd6, 0x1f, 0xf9,
+  0x69, 0xc6, 0xf3, 0x03, 0xe7, 0xcf, 0xa7, 0x47, 0x8d, 0xe7, 0x8e, 0x2c, 0x8d, 0xfd, 0x31, 0x3f,
+  0x70, 0xae, 0x42, 0x3e, 0x9b, 0x24, 0x69, 0xee, 0xb0, 0x7e, 0x12, 0xe7, 0x3c, 0x86, 0x5a, 0xb3,
+  0x30, 0xc8, 0x47, 0x07, 0x01, 0xbf, 0x0a, 0xfb, 0xbc, 0x41, 0x2f, 0x9b, 0x2c, 0x8c, 0xc3, 0x3c,
+  0xf4, 0xa3, 0x46, 0xd6, 0xf7, 0x23, 0x7e, 0xd0, 0x6e, 0xb6, 0x9c, 0xee, 0xc6, 0x7e, 0x96, 0x5f,
+  0x43, 0x1f, 0x1b, 0x7b, 0x69, 0x92, 0xe4, 0xec, 0x86, 0x35, 0x1a, 0x93, 0x34, 0x1c, 0xfb, 0xe9,
+  0xf5, 0x1e, 0x7b, 0x74, 0x74, 0x74, 0xb8, 0xdb, 0x6a, 0x75, 0x8a, 0xb2, 0xc6, 0x28, 0xb9, 0xe2,
+  0x29, 0x7d, 0x79, 0xfe, 0x52, 0x7c, 0xe9, 0xf9, 0xfd, 0xcb, 0x61, 0x9a, 0x4c, 0xe3, 0x00, 0x8a,
+  0xdb, 0xdb, 0xf8, 0x83, 0xc5, 0x39, 0xff, 0x94, 0x43, 0xc1, 0xeb, 0x16, 0xfe, 0x60, 0x41, 0xdf,
+  0x4f, 0x83, 0x46, 0x6f, 0x88, 0x95, 0x5e, 0xe3, 0x0f, 0x96, 0x65, 0x61, 0xc0, 0x7b, 0x7e, 0x2a,
+  0x8b, 0x0f, 0xf1, 0xc7, 0x2c, 0x26, 0xac, 0xf7, 0xd8, 0xf6, 0xb3, 0xd6, 0xe4, 0x13, 0x75, 0x95,
+  0xa4, 0x01, 0x4f, 0x1b, 0xfd, 0x24, 0x4a, 0x10, 0x87, 0x9d, 0x9d, 0x1d, 0x2c, 0x0d, 0xe3, 0xc9,
+  0x34, 0x17, 0x20, 0xb6, 0x5f, 0xe2, 0x0f, 0x81, 0x98, 0xf6, 0xfb, 0x3c, 0xcb, 0xa0, 0xec, 0xe9,
+  0xcb, 0xc3, 0xa3, 0x5d, 0xc2, 0x80, 0xa7, 0x29, 0xb5, 0x3b, 0x7a, 0xfa, 0x74, 0x67, 0xe7, 0x99,
+  0x68, 0x3a, 0x48, 0xb0, 0x59, 0xfb, 0xbb, 0x67, 0x47, 0x3b, 0x9d, 0xf9, 0xc6, 0x1f, 0x60, 0xfc,
+  0xbd, 0xe4, 0x13, 0x20, 0xf0, 0x39, 0x8c, 0x01, 0xa0, 0xec, 0x10, 0x8a, 0x3a, 0x0c, 0x86, 0x3f,
+  0x0c, 0xe3, 0x3d, 0x06, 0xa0, 0x26, 0x7e, 0x10, 0xd0, 0x77, 0x78, 0x9e, 0x6f, 0xf4, 0x92, 0xe0,
+  0x1a, 0xda, 0x0d, 0x80, 0xf0, 0x8d, 0x81, 0x3f, 0x0e, 0x23, 0xa0, 0x9c, 0x73, 0x0c, 0xb3, 0x90,
+  0x3a, 0x9b, 0x2c, 0xbb, 0xce, 0x72, 0x3e, 0x6e, 0x4c, 0x43, 0x78, 0xf4, 0xe3, 0xac, 0x91, 0xf1,
+  0x34, 0x1c, 0x74, 0x98, 0x49, 0xb4, 0x2b, 0x3f, 0x75, 0x4d, 0x32, 0x7a, 0x1d, 0x26, 0x47, 0x28,
+  0xbe, 0x20, 0x25, 0xa1, 0x2c, 0x08, 0xb3, 0x49, 0xe4, 0x03, 0xec, 0x41, 0xc4, 0x11, 0x9d, 0x30,
+  0x6e, 0x8c, 0x78, 0x38, 0x1c, 0x01, 0x95, 0xdb, 0xad, 0xd6, 0xd5, 0xa8, 0x23, 0x30, 0x00, 0xd4,
+  0x39, 0x94, 0x3c, 0x45, 0x8a, 0xcd, 0x37, 0x9a, 0x92, 0x94, 0x80, 0x9f, 0x24, 0xa6, 0x80, 0x69,
+  0x51, 0xd8, 0xab, 0xc3, 0xa7, 0x98, 0x1a, 0xcf, 0x18, 0x70, 0xbb, 0xb9, 0x9b, 0xf2, 0x31, 0x6b,
+  0xc3, 0x7f, 0x1d, 0x45, 0x9d, 0x54, 0x22, 0x31, 0xf9, 0xc4, 0xb2, 0x24, 0x0a, 0x03, 0x35, 0x20,
+  0x63, 0xb2, 0x10, 0x44, 0x92, 0x01, 0xef, 0x25, 0x40, 0xc0, 0x41, 0xf8, 0x89, 0x07, 0x1d, 0x56,
+  0x42, 0x1e, 0xf9, 0x6a, 0x10, 0x25, 0xb3, 0x06, 0x8c, 0xd0, 0x9f, 0xe6, 0x49, 0x87, 0xe5, 0x29,
+  0x10, 0x4c, 0xb6, 0xa1, 0xe7, 0x41, 0x92, 0x8e, 0x59, 0xab, 0xb9, 0x93, 0x31, 0xee, 0x67, 0xbc,
+  0xc3, 0x3e, 0xc3, 0xfc, 0x05, 0xfc, 0x13, 0x81, 0x68, 0xc1, 0xec, 0x35, 0xc7, 0x3e, 0x10, 0x45,
+  0x2e, 0x00, 0x9c, 0x91, 0x88, 0x3e, 0xaa, 0xa9, 0x6b, 0x44, 0x7c, 0x90, 0x2f, 0x22, 0x40, 0x69,
+  0x84, 0x76, 0xef, 0x46, 0x7b, 0xb3, 0x7f, 0xe8, 0x31, 0x4a, 0x86, 0x89, 0x9a, 0x7b, 0x49, 0xf9,
+  0xe6, 0x73, 0x6a, 0x4f, 0x45, 0x33, 0x39, 0xc6, 0x6f, 0x71, 0xa9, 0x58, 0x93, 0x2a, 0xd7, 0x93,
+  0xa7, 0x91, 0xeb, 0x25, 0x79, 0x9e, 0x8c, 0x81, 0xd9, 0x45, 0xef, 0x30, 0xe7, 0x0d, 0x3f, 0x0a,
+  0x87, 0xd0, 0x7b, 0x9f, 0x23, 0x2f, 0x51, 0x77, 0xb1, 0x7f, 0xd5, 0x18, 0xf3, 0x78, 0x0a, 0x5d,
+  0x46, 0x61, 0x06, 0x5d, 0xe2, 0xd2, 0xdd, 0x63, 0x71, 0x12, 0x73, 0xfd, 0x3d, 0x04, 0x7e, 0x83,
+  0xef, 0x25, 0xb0, 0x2d, 0x39, 0x2c, 0x59, 0x29, 0x0a, 0xe3, 0x4b, 0xa8, 0x54, 0xe2, 0x29, 0xea,
+  0x90, 0x00, 0x64, 0x45, 0xb7, 0x43, 0x7f, 0x82, 0xcd, 0xc5, 0xa8, 0x0a, 0xce, 0xa7, 0x82, 0x12,
+  0x23, 0xf8, 0x41, 0x38, 0xcd, 0x8a, 0xbe, 0xd4, 0x3a, 0xed, 0xf7, 0xfb, 0x72, 0x44, 0x01, 0xef,
+  0x27, 0xa9, 0x2f, 0x88, 0x2a, 0x90, 0x36, 0xc9, 0xec, 0x47, 0x11, 0xb4, 0xdd, 0x56, 0xe4, 0xb5,
+  0x28, 0x48, 0x62, 0xc8, 0x40, 0x7e, 0x8f, 0x04, 0xd1, 0x26, 0xd3, 0x05, 0x4d, 0xbf, 0x9f, 0x87,
+  0x57, 0x1c, 0x17, 0x70, 0x85, 0x97, 0x0b, 0x62, 0x5b, 0x73, 0x60, 0x2d, 0x39, 0x80, 0x8d, 0x12,
+  0xaa, 0xb6, 0xbd, 0x14, 0x5d, 0x5e, 0x65, 0xa4, 0x6d, 0x9b, 0x28, 0x8a, 0x77, 0x48, 0x84, 0x8c,
+  0xfc, 0x20, 0x99, 0x01, 0x31, 0xd8, 0x33, 0x58, 0x18, 0xed, 0x6d, 0xf8, 0x2f, 0x1d, 0xf6, 0x7c,
+  0xb7, 0xb5, 0x49, 0x3f, 0xcd, 0x9d, 0xea, 0xd4, 0xb7, 0xf5, 0x1c, 0x8d, 0xda, 0x9b, 0x6c, 0xb4,
+  0x0d, 0xb8, 0xac, 0xc6, 0x33, 0xed, 0x2a, 0xc7, 0x3d, 0x23, 0x7a, 0xb1, 0x51, 0xbb, 0x9e, 0x3b,
+  0xe7, 0x02, 0xbc, 0xf5, 0x45, 0x33, 0xc8, 0x30, 0x0d, 0x03, 0x93, 0x39, 0xf0, 0xbd, 0x43, 0xff,
+  0x83, 0x2c, 0x1a, 0x43, 0x59, 0xce, 0x71, 0x59, 0x4f, 0xc7, 0x31, 0x90, 0x20, 0xe5, 0x13, 0xee,
+  0xe7, 0x2e, 0x2e, 0xd9, 0xc6, 0x20, 0xcc, 0x37, 0x51, 0x30, 0x8d, 0xfd, 0x4f, 0xee, 0xf6, 0x36,
+  0x08, 0xed, 0x4d, 0xd6, 0x1e, 0xa4, 0x9e, 0x27, 0x99, 0xc8, 0xe8, 0x22, 0xcb, 0xfd, 0xbc, 0xb1,
+  0x90, 0xde, 0x4a, 0xa2, 0x7b, 0xb5, 0xb4, 0x2d, 0xf1, 0xda, 0xb7, 0xbb, 0xcb, 0x56, 0x0c, 0x75,
+  0x14, 0xf9, 0x3d, 0x50, 0xab, 0xd6, 0x70, 0x5b, 0xcd, 0xef, 0x2c, 0x1e, 0xf5, 0x7d, 0xbf, 0xb3,
+  0x64, 0xcd, 0x10, 0x98, 0x2b, 0x3f, 0x9a, 0x72, 0x1b, 0xcc, 0xf6, 0x7a, 0x6b, 0x7d, 0xbe, 0x91,
+  0xfb, 0xbd, 0x88, 0x17, 0xd2, 0x18, 0x24, 0xd7, 0x3f, 0xe9, 0x31, 0x41, 0xa3, 0xc8, 0x9f, 0x64,
+  0x00, 0x56, 0x3d, 0x75, 0xd6, 0x61, 0x46, 0x4d, 0x0a, 0x25, 0x4a, 0xf7, 0xd8, 0x28, 0x0c, 0x02,
+  0x1e, 0x53, 0xbf, 0xa0, 0xfd, 0x73, 0xa4, 0xb6, 0xb1, 0x82, 0xbf, 0x2b, 0x56, 0xb0, 0x49, 0x3d,
+  0x14, 0x73, 0x9d, 0x42, 0xf5, 0x49, 0x16, 0x5b, 0x2e, 0xdd, 0xb1, 0x83, 0xbb, 0xa6, 0xb2, 0x86,
+  0x3f, 0x37, 0xf2, 0x54, 0x2c, 0xe4, 0x52, 0xdb, 0x47, 0xdb, 0xbb, 0xf8, 0x43, 0xa4, 0xef, 0xe5,
+  0xb1, 0xc9, 0x8c, 0x61, 0x0c, 0xab, 0x9d, 0x37, 0x96, 0x08, 0xac, 0x5f, 0xa6, 0x59, 0x1e, 0x0e,
+  0xae, 0x95, 0x22, 0xa8, 0x48, 0xb2, 0xdd, 0xb2, 0x24, 0xfb, 0x96, 0xe8, 0xd0, 0xdc, 0x5e, 0x26,
+  0xcb, 0xd6, 0x17, 0x5f, 0x02, 0x90, 0xaa, 0xd8, 0x9f, 0xa6, 0x19, 0x72, 0xc4, 0x24, 0x09, 0x05,
+  0x32, 0x55, 0xe9, 0x36, 0x1b, 0xc1, 0x40, 0x1a, 0xd9, 0xc4, 0xef, 0x93, 0x48, 0x9f, 0xa5, 0xfe,
+  0xa4, 0x23, 0xc6, 0xaf, 0x38, 0xe8, 0xfe, 0xc2, 0x8d, 0x99, 0x60, 0x6a, 0x49, 0x6e, 0x01, 0x13,
+  0x66, 0x9e, 0xa7, 0xe8, 0x0f, 0x56, 0x0b, 0x10, 0x33, 0x58, 0x84, 0x81, 0x31, 0xc7, 0x75, 0x86,
+  0x8b, 0x22, 0xc4, 0x5d, 0x2c, 0xc4, 0xec, 0xae, 0xea, 0x19, 0x63, 0xe7, 0x39, 0xfe, 0x68, 0xc4,
+  0x02, 0xb0, 0xa6, 0x17, 0x0c, 0x85, 0xac, 0xbd, 0x02, 0x25, 0xa2, 0xae, 0xee, 0x45, 0xb4, 0xab,
+  0xef, 0xe2, 0xd5, 0xce, 0xf6, 0xd1, 0xf6, 0x91, 0xee, 0x22, 0x04, 0x7c, 0xec, 0x75, 0xf3, 0x4c,
+  0x30, 0x8a, 0xd1, 0x86, 0xd8, 0x60, 0xe2, 0xa7, 0xc0, 0x68, 0x2b, 0x8f, 0xd7, 0xd2, 0x8e, 0x12,
+  0x2d, 0xec, 0x6b, 0xc9, 0xec, 0x2c, 0x22, 0xb4, 0x29, 0x60, 0x9a, 0x3d, 0x3f, 0x18, 0x72, 0x1b,
+  0xe1, 0x1d, 0x64, 0x70, 0x8d, 0x77, 0x99, 0xc1, 0x77, 0x0a, 0x19, 0xa6, 0x64, 0x63, 0x8d, 0x09,
+  0xa3, 0x14, 0x70, 0x94, 0xf4, 0x2f, 0x39, 0x08, 0x20, 0xd9, 0xcb, 0x1a, 0x74, 0xf7, 0xaf, 0xfc,
+  0x30, 0x42, 0xf1, 0x57, 0xdb, 0xf8, 0xd1, 0xb3, 0xa7, 0x2f, 0x76, 0x8f, 0x9e, 0xd5, 0xb4, 0x03,
+  0x95, 0x93, 0x5f, 0xd7, 0xb7, 0xf9, 0x76, 0x17, 0x7f, 0x6a, 0xda, 0x48, 0xf3, 0x7f, 0x09, 0x9a,
+  0xb2, 0x46, 0x15, 0xd1, 0x0d, 0xa2, 0xf2, 0x59, 0x7e, 0x3d, 0x01, 0xbf, 0x0a, 0x59, 0xd8, 0x39,
+  0x47, 0xc7, 0xa9, 0x28, 0x8b, 0xa7, 0xe3, 0x1e, 0xd8, 0xf6, 0xa5, 0xd2, 0x89, 0x9f, 0x65, 0x33,
+  0x20, 0x2d, 0x96, 0x67, 0x3c, 0xe2, 0xfd, 0xbc, 0x2c, 0xe5, 0x4b, 0xb6, 0xd3, 0xca, 0x8c, 0xb2,
+  0x40, 0x22, 0xd5, 0x28, 0xb3, 0xb5, 0x97, 0x26, 0xcc, 0x27, 0x1a, 0xd5, 0x0d, 0x6c, 0x34, 0xa9,
+  0x1a, 0x8d, 0x4a, 0x26, 0x02, 0x41, 0x8d, 0x6a, 0x4a, 0x9b, 0x6a, 0x91, 0xdc, 0x43, 0x9e, 0xa8,
+  0xd1, 0x9e, 0x4f, 0x17, 0x73, 0x11, 0x81, 0x13, 0xa2, 0xbc, 0x6a, 0x86, 0x5a, 0x16, 0xa7, 0x25,
+  0xe2, 0xf1, 0x7b, 0x83, 0xc7, 0x41, 0x81, 0x92, 0x84, 0x41, 0xe3, 0xdc, 0xb4, 0xcb, 0xf4, 0x2c,
+  0x68, 0x3f, 0x60, 0xbe, 0xf1, 0x08, 0x0c, 0x76, 0x54, 0x0c, 0x40, 0xee, 0x0a, 0x33, 0xb5, 0x0c,
+  0xc5, 0xfd, 0xa8, 0x75, 0x64, 0xfa, 0x79, 0x42, 0x49, 0x2a, 0x8f, 0x65, 0x7b, 0x97, 0xfc, 0xd1,
+  0xaa, 0xc7, 0xb2, 0x6c, 0xa6, 0xb4, 0x67, 0xf8, 0x32, 0x99, 0xa6, 0x21, 0x2c, 0xf0, 0x9f, 0xf8,
+  0x0c, 0xfc, 0xc3, 0x71, 0x12, 0x27, 0x24, 0xf2, 0x4b, 0xf2, 0x7f, 0x92, 0x82, 0xd3, 0x8e, 0x1a,
+  0x00, 0xa9, 0x35, 0x4e, 0x7a, 0x21, 0x2c, 0x1b, 0x8c, 0x17, 0x90, 0x64, 0xd0, 0xf4, 0xd2, 0x86,
+  0xbf, 0x72, 0x67, 0x06, 0xe0, 0xc3, 0x53, 0x15, 0x39, 0x19, 0x79, 0x32, 0x51, 0xc8, 0xc9, 0xc1,
+  0x88, 0x22, 0xcb, 0x6e, 0x17, 0x25, 0xcb, 0x99, 0xb0, 0x46, 0x3c, 0x28, 0x52, 0x3d, 0x7f, 0xfe,
+  0xbc, 0xd6, 0xfc, 0x92, 0x66, 0xd3, 0x34, 0x03, 0x97, 0x25, 0xcb, 0x7c, 0x5b, 0x28, 0x2d, 0x75,
+  0x1c, 0x4c, 0xe4, 0xdb, 0x0b, 0xad, 0xbb, 0x0a, 0x63, 0x15, 0x1d, 0xca, 0xc5, 0x6d, 0xcd, 0x70,
+  0xc3, 0x5a, 0x00, 0x0b, 0x96, 0x3f, 0x8a, 0x0e, 0x01, 0x82, 0xc4, 0xd8, 0x12, 0x00, 0xb5, 0x62,
+  0xae, 0x68, 0x8e, 0x91, 0x85, 0x25, 0xad, 0xf1, 0x73, 0xa5, 0x31, 0x78, 0x20, 0x23, 0xde, 0xbf,
+  0x44, 0xef, 0xa1, 0xb2, 0xc6, 0xee, 0x76, 0xd0, 0xa4, 0xcf, 0x55, 0xb6, 0x33, 0x00, 0xa5, 0x12,
+  0x54, 0x5a, 0x2b, 0x85, 0x70, 0x12, 0xdc, 0x31, 0xdf, 0xf8, 0xe7, 0x31, 0x0f, 0x42, 0x9f, 0xb9,
+  0x60, 0xbc, 0xab, 0xc0, 0xcb, 0xb7, 0xcf, 0x9e, 0x4f, 0x3e, 0x79, 0xec, 0x66, 0x83, 0x31, 0x23,
+  0x90, 0xa0, 0x7d, 0x71, 0xa9, 0xf7, 0xd0, 0x1f, 0xf8, 0x17, 0xb7, 0x81, 0x42, 0x0e, 0x86, 0x24,
+  0x9b, 0x3e, 0x47, 0x89, 0x67, 0x80, 0xda, 0x69, 0xb5, 0x44, 0x44, 0xa2, 0x00, 0x55, 0x78, 0x6c,
+  0xf5, 0x10, 0x5b, 0x9e, 0xac, 0x5f, 0x72, 0xeb, 0x2d, 0x6f, 0xbe, 0x55, 0x62, 0x6c, 0x65, 0xb1,
+  0x63, 0xb3, 0x45, 0xab, 0x46, 0xd0, 0xb2, 0x62, 0x26, 0xd2, 0xca, 0x6b, 0xf4, 0x78, 0x3e, 0xe3,
+  0x68, 0x33, 0xd7, 0xd2, 0xba, 0x12, 0xc5, 0xa0, 0x4e, 0x01, 0x09, 0x8d, 0x8d, 0x6d, 0xd8, 0xaf,
+  0x18, 0x56, 0xb1, 0xbc, 0x69, 0x33, 0xac, 0xb1, 0xad, 0xc6, 0x02, 0x4e, 0x3f, 0x0c, 0x70, 0x38,
+  0xac, 0x88, 0x2d, 0x21, 0x02, 0x4a, 0xc6, 0x66, 0xbd, 0x71, 0x50, 0xe3, 0x07, 0x56, 0xd9, 0x05,
+  0x7b, 0xb3, 0xa5, 0x33, 0x09, 0xdd, 0x20, 0x4c, 0x41, 0x98, 0xd2, 0xc8, 0x85, 0xeb, 0x57, 0x22,
+  0x50, 0x96, 0xa7, 0x3c, 0xef, 0x8f, 0x04, 0x00, 0xe5, 0xe4, 0x94, 0x35, 0x84, 0x96, 0x98, 0x9f,
+  0x14, 0xdb, 0xd5, 0xd9, 0xbc, 0x00, 0x02, 0x04, 0x75, 0x9e, 0xf8, 0x19, 0xce, 0x76, 0x85, 0xe2,
+  0x2a, 0xdc, 0x24, 0x05, 0x88, 0xe9, 0x01, 0x9b, 0xfc, 0xb6, 0x4d, 0xfc, 0x56, 0xf1, 0x76, 0x96,
+  0x5b, 0xf9, 0xb6, 0x29, 0x50, 0xd5, 0x5c, 0x25, 0xc1, 0xab, 0x67, 0x6a, 0xbb, 0x25, 0xf4, 0xda,
+  0xfe, 0x96, 0x08, 0xa6, 0xee, 0x6f, 0x89, 0xd8, 0x2e, 0x86, 0x06, 0xbb, 0x1b, 0xfb, 0x41, 0x78,
+  0xc5, 0xfa, 0x11, 0x18, 0x08, 0x07, 0x8e, 0xc5, 0x94, 0x4e, 0xd7, 0xfc, 0x84, 0xb1, 0x24, 0xa7,
+  0xab, 0x43, 0xbf, 0xf0, 0x05, 0x00, 0x4c, 0x61, 0x7c, 0xb1, 0x6e, 0x5c, 0x70, 0x81, 0xc3, 0x92,
+  0xb8, 0x1f, 0x85, 0xfd, 0x4b, 0xb0, 0x51, 0xa8, 0xe0, 0x44, 0x30, 0x96, 0xeb, 0x39, 0xdd, 0x27,
+  0x8f, 0xbe, 0xfb, 0xf6, 0xdb, 0x67, 0x9d, 0xfd, 0x2d, 0xd1, 0xba, 0x2b, 0x60, 0x6d, 0xec, 0xfb,
+  0xc8, 0x7c, 0x0a, 0x96, 0x64, 0x44, 0xa7, 0x0b, 0xf3, 0x75, 0x07, 0x16, 0x58, 0x63, 0x1a, 0xa9,
+  0x0a, 0x2a, 0x06, 0x45, 0x2d, 0xe1, 0x4b, 0x14, 0x9a, 0x5f, 0x90, 0x1d, 0x60, 0x58, 0x3e, 0x1b,
+  0xa5, 0x7c, 0x70, 0xe0, 0xfc, 0x02, 0x46, 0x5f, 0xd6, 0x4f, 0xc3, 0x49, 0xbe, 0x77, 0x95, 0x84,
+  0x01, 0xac, 0x69, 0xc7, 0xac, 0x4d, 0x61, 0x28, 0x21, 0x06, 0x8c, 0x01, 0x65, 0xa3, 0x64, 0x76,
+  0x22, 0xb8, 0xcd, 0x7d, 0x18, 0xf8, 0xd9, 0xa8, 0x97, 0x80, 0xcf, 0xfb, 0x10, 0x46, 0xf6, 0x4a,
+  0xbd, 0xec, 0x6f, 0xf9, 0x30, 0xac, 0x28, 0xfc, 0x42, 0x38, 0x2c, 0xea, 0x3c, 0x8b, 0x92, 0x3c,
+  0x43, 0x09, 0x31, 0x08, 0x87, 0xd8, 0xff, 0x09, 0xbc, 0x5f, 0xd2, 0xdb, 0x54, 0xf8, 0x81, 0x5f,
+  0x09, 0x0f, 0xc9, 0x77, 0x06, 0x26, 0x87, 0xf1, 0x67, 0x60, 0x4c, 0xfe, 0x95, 0xfa, 0xcf, 0xc3,
+  0x31, 0x4a, 0xd8, 0xa2, 0xfb, 0x7f, 0xe3, 0x00, 0x3c, 0x8c, 0xb3, 0x9c, 0x47, 0xd1, 0x14, 0x5c,
+  0xa9, 0xaf, 0x46, 0x88, 0x24, 0x49, 0x0d, 0x34, 0x4e, 0x6f, 0x7f, 0x4b, 0x33, 0x0e, 0xd6, 0x5c,
+  0xfa, 0xd5, 0x30, 0x98, 0xf8, 0xd7, 0xc0, 0xfd, 0xb9, 0x49, 0x0b, 0x7f, 0x84, 0x34, 0xc8, 0xc6,
+  0x61, 0x0e, 0xe4, 0xf8, 0x5a, 0x33, 0x02, 0xc6, 0xed, 0x30, 0xf5, 0xc7, 0x06, 0x1e, 0x2f, 0x78,
+  0xec, 0xf7, 0x47, 0x69, 0xd8, 0x1f, 0xe5, 0xc0, 0x9f, 0x5f, 0x71, 0x52, 0x62, 0x50, 0x99, 0x49,
+  0x7a, 0x69, 0xa0, 0xf2, 0x13, 0xcf, 0x3f, 0xcf, 0x78, 0x7a, 0xf9, 0xd5, 0xe6, 0x44, 0xf8, 0x5e,
+  0x06, 0x06, 0x1f, 0x44, 0x51, 0xfe, 0xb5, 0x04, 0x85, 0x1f, 0xf1, 0x0c, 0xfb, 0xfd, 0x0b, 0x8c,
+  0xfa, 0xf6, 0xd7, 0xe9, 0xe0, 0x6b, 0xad, 0x4c, 0x10, 0xd7, 0xd4, 0xef, 0x5b, 0xf8, 0xfd, 0x95,
+  0xba, 0x4c, 0x72, 0xbf, 0x31, 0x9d, 0x04, 0x18, 0x05, 0xce, 0x44, 0x19, 0x89, 0x46, 0xda, 0xe8,
+  0x62, 0x7f, 0xa6, 0x0f, 0x26, 0x26, 0xfb, 0x5b, 0xd3, 0xa8, 0xac, 0x64, 0x6c, 0x77, 0x85, 0xa8,
+  0x96, 0x91, 0x8e, 0xdf, 0x07, 0x53, 0x20, 0x66, 0x61, 0x70, 0xe0, 0x0c, 0xc2, 0x74, 0x3c, 0xf3,
+  0x53, 0xdc, 0x27, 0xdd, 0xc2, 0x42, 0xd0, 0x85, 0x69, 0x81, 0xfe, 0x28, 0xcf, 0x27, 0x7b, 0x5b,
+  0x5b, 0xb3, 0xd9, 0xac, 0x39, 0xf2, 0x63, 0x30, 0x70, 0xf2, 0xa6, 0x9f, 0x3b, 0x60, 0x78, 0xa4,
+  0x43, 0xdc, 0x21, 0xfd, 0xd8, 0x8b, 0x7c, 0x18, 0x40, 0xd7, 0xfe, 0x2e, 0xb0, 0x12, 0xba, 0x70,
+  0x8b, 0x94, 0x21, 0x3c, 0xa0, 0x71, 0xa9, 0xf5, 0xab, 0x61, 0x68, 0x0a, 0xc5, 0xf8, 0xa0, 0xd1,
+  0x60, 0x5a, 0xe9, 0x30, 0x49, 0x02, 0xd6, 0x68, 0xd0, 0x47, 0x39, 0x7a, 0x42, 0x57, 0xab, 0x29,
+  0x4d, 0x46, 0x09, 0x47, 0xd1, 0x08, 0xf7, 0x7b, 0xdb, 0xa6, 0x02, 0x83, 0x37, 0x93, 0x24, 0x18,
+  0x5e, 0x57, 0x2a, 0xd5, 0xa4, 0x94, 0x0a, 0x94, 0xdb, 0xb6, 0x42, 0x11, 0xd6, 0x26, 0xe2, 0x0d,
+  0x6e, 0x7f, 0x1b, 0x02, 0x3d, 0x39, 0x3b, 0xba, 0xfd, 0x15, 0xac, 0xfd, 0x54, 0x5a, 0x0f, 0xe5,
+  0x06, 0x14, 0xc0, 0x76, 0x08, 0x5f, 0x7a, 0xd7, 0x11, 0x19, 0xa7, 0xdb, 0x90, 0x4d, 0x94, 0xc2,
+  0x5f, 0x1b, 0x8b, 0xc3, 0xcb, 0x7c, 0x0a, 0xca, 0x80, 0x67, 0xec, 0xcd, 0x34, 0x1f, 0x41, 0x59,
+  0xbc, 0x22, 0x12, 0xfd, 0x14, 0xfc, 0x8e, 0xfc, 0x0b, 0x60, 0xa0, 0x39, 0x10, 0xb4, 0x15, 0x5f,
+  0xb1, 0xf3, 0x29, 0x55, 0x2e, 0x75, 0xbe, 0x00, 0x05, 0xea, 0x9d, 0x91, 0x81, 0x87, 0xac, 0x62,
+  0xb8, 0xa8, 0xc2, 0x7a, 0xc4, 0x19, 0xde, 0xee, 0x9e, 0xf4, 0x47, 0x31, 0xd0, 0xc1, 0xbf, 0xc4,
+  0x49, 0x47, 0x22, 0x40, 0x19, 0x81, 0xb2, 0x81, 0x19, 0x26, 0x76, 0x19, 0x66, 0x69, 0x3b, 0xc8,
+  0x51, 0xcd, 0x01, 0x00, 0xed, 0x80, 0xc2, 0x02, 0xf3, 0x1b, 0xfe, 0x24, 0x3c, 0x70, 0xb6, 0xe0,
+  0xff, 0x2d, 0x49, 0xbf, 0x65, 0x80, 0xc9, 0x82, 0x07, 0x87, 0x61, 0x86, 0x51, 0x10, 0x9b, 0x80,
+  0x45, 0x5c, 0x67, 0x01, 0x1a, 0x60, 0xd7, 0x96, 0x9b, 0x0b, 0x37, 0x12, 0x5a, 0x1e, 0x38, 0x60,
+  0x5e, 0x1f, 0x8e, 0xc1, 0x11, 0x81, 0xf9, 0x53, 0xd3, 0xce, 0xbe, 0xd9, 0x02, 0x6a, 0x52, 0x9d,
+  0xee, 0xbe, 0xf0, 0x35, 0xad, 0xb8, 0x19, 0x74, 0xc3, 0x27, 0x07, 0x4e, 0xab, 0xd9, 0x6a, 0x8b,
+  0x89, 0x28, 0x60, 0xc8, 0x64, 0x06, 0x3f, 0x40, 0xdf, 0xcc, 0x61, 0x60, 0xf2, 0xf4, 0xf9, 0x28,
+  0x89, 0xc0, 0x52, 0x3e, 0x70, 0x5e, 0x70, 0x70, 0x0d, 0x87, 0x0e, 0x4b, 0xf9, 0x5f, 0xa7, 0xe0,
+  0x8b, 0x04, 0x5d, 0xdb, 0x42, 0x16, 0x5d, 0x64, 0xd3, 0xde, 0xd8, 0xa0, 0x05, 0x6e, 0x1d, 0x18,
+  0x71, 0x6f, 0xa7, 0xfb, 0xfe, 0x47, 0xc3, 0x28, 0xc6, 0xa1, 0x1b, 0xb4, 0xb5, 0x4d, 0x6d, 0xd5,
+  0x54, 0x04, 0x8a, 0x0d, 0x51, 0x08, 0x24, 0x77, 0x1f, 0x1a, 0x84, 0x7f, 0xb8, 0xc9, 0x6e, 0x52,
+  0x9e, 0xf1, 0x1c, 0x7d, 0xd7, 0x29, 0x9f, 0x7b, 0x06, 0x25, 0xfe, 0x84, 0xe5, 0xba, 0x47, 0xc5,
+  0x05, 0x05, 0x77, 0xdd, 0xcd, 0x12, 0xe8, 0xdb, 0xb7, 0x25, 0x73, 0xd5, 0x23, 0xa8, 0xe3, 0xe5,
+  0xd6, 0x6c, 0xef, 0xc1, 0x44, 0xd5, 0xe1, 0x4c, 0x06, 0xed, 0x16, 0x88, 0xd0, 0x30, 0x8a, 0x10,
+  0x73, 0x44, 0xf7, 0x10, 0x56, 0xad, 0x12, 0x1c, 0xe0, 0x96, 0x0d, 0x40, 0x98, 0x40, 0x49, 0x5c,
+  0x50, 0xea, 0xcb, 0x75, 0x9c, 0xf3, 0x2c, 0xb7, 0xba, 0xfd, 0x13, 0x8f, 0xfc, 0x30, 0x63, 0x58,
+  0x6e, 0xf6, 0x68, 0x2c, 0x40, 0xe3, 0x11, 0x56, 0xd2, 0x11, 0x58, 0x38, 0xb7, 0xbf, 0xf5, 0x50,
+  0x5d, 0x80, 0x99, 0x43, 0x8b, 0x6b, 0x9f, 0xbc, 0x4d, 0xf8, 0x25, 0xd3, 0x69, 0x52, 0x7c, 0xa4,
+  0x8a, 0xfb, 0x5b, 0xf0, 0x80, 0x2f, 0x27, 0x14, 0x93, 0xd1, 0xaf, 0x1f, 0x52, 0x0e, 0x7d, 0xba,
+  0x4f, 0xf8, 0x34, 0x4d, 0x3a, 0x9e, 0x2e, 0x3e, 0xd4, 0x4b, 0x16, 0x0b, 0xb6, 0x10, 0xd0, 0x96,
+  0x02, 0x4a, 0x39, 0x1e, 0x24, 0x35, 0x60, 0x1c, 0x8d, 0x5c, 0xc8, 0x4c, 0xf8, 0x4c, 0x0e, 0x1e,
+  0xfc, 0x26, 0x14, 0x48, 0xd9, 0x49, 0x71, 0xdf, 0xdd, 0x50, 0xea, 0x03, 0x7d, 0x86, 0x8c, 0xbd,
+  0x24, 0xcb, 0x64, 0x99, 0x06, 0x31, 0x7d, 0x8d, 0x85, 0x4a, 0x44, 0x91, 0x5a, 0x39, 0xa2, 0xe4,
+  0x87, 0x0a, 0xd5, 0x52, 0xe3, 0x9b, 0x40, 0x69, 0xbd, 0x14, 0xeb, 0xd6, 0x4a, 0x12, 0x31, 0x47,
+  0x7d, 0xb1, 0x9c, 0x17, 0x08, 0x09, 0x6b, 0xf5, 0x83, 0xbf, 0x4d, 0xa3, 0x3b, 0xc6, 0x55, 0x4e,
+  0x3e, 0x09, 0x98, 0xc2, 0x0c, 0x45, 0x1f, 0xee, 0x60, 0x28, 0x96, 0x72, 0xdb, 0x0d, 0xa1, 0xd6,
+  0xb5, 0x96, 0xfd, 0xd4, 0xa0, 0xae, 0xb4, 0x6a, 0xf7, 0xf6, 0x96, 0x0a, 0x0c, 0xa4, 0x8e, 0xdd,
+  0x95, 0x14, 0x14, 0x02, 0x55, 0xdc, 0x71, 0x3e, 0x70, 0xda, 0x55, 0xd1, 0x30, 0xe9, 0x0a, 0xf6,
+  0xf2, 0xa7, 0xd9, 0xf0, 0xf6, 0x57, 0x58, 0xc7, 0x0c, 0x8c, 0x33, 0x3f, 0xc6, 0x58, 0x4f, 0x61,
+  0x67, 0xa4, 0x1c, 0x1d, 0x2b, 0x89, 0x4f, 0x43, 0xd9, 0x1a, 0x5b, 0x13, 0x68, 0x4e, 0xdf, 0xc3,
+  0xed, 0x7e, 0x43, 0xc4, 0xf4, 0xe8, 0xf3, 0x64, 0x4d, 0x89, 0x73, 0x32, 0xe1, 0x21, 0x52, 0x21,
+  0x2e, 0x0b, 0x9e, 0x12, 0x63, 0x13, 0x4f, 0x72, 0xe6, 0xc7, 0x68, 0xcb, 0x4a, 0xb5, 0x51, 0x31,
+  0x0f, 0x08, 0x21, 0x00, 0xdd, 0xe7, 0x0d, 0x61, 0x2e, 0x14, 0xfe, 0x79, 0x95, 0xef, 0x5e, 0x09,
+  0x16, 0x59, 0x81, 0xf3, 0x6c, 0xef, 0xf2, 0x3e, 0xbc, 0x27, 0xbd, 0x51, 0x13, 0x7d, 0xdb, 0xba,
+  0x11, 0x5c, 0x57, 0x2c, 0x63, 0xb2, 0xfb, 0x1a, 0xa7, 0xfc, 0x13, 0xda, 0x8a, 0x4a, 0x43, 0xd6,
+  0xab, 0x37, 0x42, 0x6a, 0x4b, 0x76, 0xea, 0x2c, 0x14, 0x9c, 0x35, 0xec, 0x09, 0x93, 0x3a, 0xf4,
+  0xe3, 0x8f, 0xa1, 0xe0, 0xce, 0x13, 0x7a, 0x63, 0x2e, 0x89, 0x0f, 0x16, 0x80, 0xa5, 0x20, 0xb0,
+  0xd8, 0xc4, 0xb0, 0x51, 0xd3, 0xe0, 0x08, 0xd1, 0xac, 0x01, 0xa5, 0x9a, 0x41, 0xd9, 0xbf, 0xd1,
+  0x2c, 0xc6, 0x0b, 0x18, 0x95, 0x76, 0x89, 0x8c, 0xb6, 0xb2, 0x4b, 0xc9, 0xa5, 0xa2, 0xcc, 0xe9,
+  0x2e, 0x17, 0xfc, 0x35, 0xf8, 0x0b, 0xeb, 0x58, 0xe1, 0x6f, 0xd0, 0x8c, 0xb9, 0x53, 0x8c, 0xd6,
+  0x81, 0xcc, 0x44, 0xc4, 0x22, 0x2e, 0x87, 0xb0, 0xd3, 0x5a, 0x19, 0x4f, 0x0b, 0xb4, 0xc4, 0x53,
+  0x1a, 0xe3, 0x08, 0x0b, 0xc4, 0xff, 0x30, 0x1f, 0x1d, 0x38, 0x3b, 0xad, 0xca, 0xaa, 0xda, 0xb0,
+  0xd5, 0xe5, 0x7d, 0x57, 0x81, 0x14, 0xee, 0x4a, 0x07, 0x2b, 0xc3, 0xab, 0xc2, 0xc5, 0xa7, 0x14,
+  0x79, 0x58, 0x81, 0x89, 0xad, 0x10, 0xc5, 0x7d, 0x78, 0xb8, 0x26, 0xa4, 0x51, 0xcb, 0xc4, 0xcb,
+  0xb8, 0x54, 0x20, 0x51, 0x63, 0xc6, 0x2f, 0x9a, 0xe2, 0x7e, 0x12, 0xc6, 0x1f, 0x03, 0x4e, 0x9c,
+  0xfd, 0xee, 0xf6, 0xb7, 0xf8, 0x33, 0x08, 0x4e, 0x3f, 0xed, 0x01, 0x2a, 0x80, 0x82, 0x98, 0x55,
+  0x30, 0xef, 0x3f, 0x27, 0x1c, 0x8c, 0x10, 0x2c, 0x71, 0xc7, 0xd9, 0x0a, 0xc2, 0xd2, 0x80, 0xaa,
+  0x25, 0x65, 0x18, 0xbf, 0x12, 0x05, 0x75, 0xf3, 0xb9, 0x0a, 0xaa, 0x3d, 0x30, 0x19, 0x3e, 0x52,
+  0xf9, 0x47, 0xb4, 0x99, 0x13, 0x5a, 0x53, 0x30, 0xa9, 0xe0, 0x3e, 0xbd, 0x49, 0xa7, 0x93, 0x09,
+  0xd8, 0x3b, 0xa7, 0xa2, 0x5c, 0xe0, 0xbd, 0x1a, 0xaa, 0x35, 0x50, 0x25, 0xca, 0xf8, 0xe5, 0x0d,
+  0x7e, 0x38, 0x55, 0xe5, 0xf7, 0xc5, 0x1c, 0x27, 0xfb, 0xa3, 0xb0, 0xf3, 0xd1, 0x2c, 0x60, 0xef,
+  0xf9, 0x60, 0x10, 0x63, 0xc4, 0x06, 0x84, 0x56, 0xbe, 0x22, 0x9e, 0x05, 0x0c, 0x89, 0x1e, 0x16,
+  0xf0, 0x38, 0xe3, 0xa7, 0x54, 0xf6, 0xbb, 0x50, 0x03, 0xe6, 0xe9, 0x83, 0xd5, 0x18, 0xe1, 0x1a,
+  0x41, 0x94, 0x80, 0xd1, 0x93, 0xc1, 0x80, 0xc7, 0x85, 0x55, 0xe6, 0x9e, 0xe4, 0x69, 0x32, 0xee,
+  0x4d, 0x03, 0xf0, 0x6e, 0x37, 0x59, 0xbb, 0xf1, 0x74, 0x55, 0x8c, 0x09, 0x74, 0x09, 0x63, 0x58,
+  0x4b, 0xfd, 0x69, 0x9a, 0xf2, 0xb8, 0x7f, 0x5d, 0xe8, 0x4e, 0x98, 0xb2, 0x03, 0xe7, 0xe9, 0xfd,
+  0x07, 0x72, 0xc9, 0xaf, 0x27, 0x7e, 0x20, 0xa9, 0xfc, 0x23, 0xbd, 0xb0, 0xd7, 0xb0, 0x16, 0xa0,
+  0x86, 0x66, 0x8b, 0xd5, 0x28, 0x6d, 0x42, 0x92, 0x98, 0x8b, 0xa2, 0xdf, 0xcd, 0x07, 0xa8, 0xe4,
+  0x3f, 0x66, 0x3c, 0x32, 0x78, 0x01, 0x4c, 0x83, 0x19, 0xda, 0x2c, 0x4a, 0x81, 0xad, 0x87, 0xaa,
+  0x0d, 0xb0, 0x10, 0xf7, 0xf9, 0x09, 0x6d, 0x3d, 0x7f, 0x39, 0xc6, 0xa5, 0xc5, 0xa6, 0x14, 0xfa,
+  0x7a, 0x38, 0x5a, 0x30, 0x0c, 0x4e, 0x00, 0x48, 0xcb, 0xf1, 0x5b, 0x4b, 0xc0, 0x93, 0xf0, 0x8c,
+  0xd9, 0x1d, 0xd6, 0x4e, 0x9d, 0x95, 0x92, 0x24, 0x29, 0x88, 0x75, 0x0c, 0xe1, 0x2e, 0x35, 0x51,
+  0x8a, 0xb8, 0xef, 0x7d, 0x64, 0xbb, 0x1d, 0x27, 0x5e, 0xd3, 0x2c, 0x56, 0x16, 0x08, 0xa0, 0x90,
+  0x15, 0xf6, 0xc7, 0xa4, 0x0b, 0xec, 0xcd, 0x48, 0x9e, 0x00, 0x65, 0xd4, 0x10, 0x86, 0x61, 0x2f,
+  0x87, 0xf6, 0x99, 0x72, 0x6c, 0x06, 0x60, 0xd6, 0x6d, 0xb2, 0x2c, 0xe9, 0xf9, 0x51, 0xc0, 0x82,
+  0x10, 0x18, 0x0c, 0x30, 0x11, 0xab, 0x9b, 0x8d, 0x39, 0x78, 0xb6, 0x79, 0x93, 0xdd, 0xfe, 0x17,
+  0x88, 0x23, 0x9e, 0xb3, 0x0c, 0x3e, 0xc7, 0xe8, 0xd6, 0x6c, 0xb2, 0x59, 0x98, 0x42, 0x75, 0x58,
+  0xf8, 0x18, 0x4e, 0x04, 0x97, 0x0c, 0xf7, 0x3c, 0x2f, 0x43, 0x9e, 0x42, 0xed, 0x13, 0x39, 0x8c,
+  0x3d, 0x82, 0xad, 0x3c, 0xa8, 0xc6, 0xa1, 0xb6, 0x71, 0xdd, 0xc2, 0x92, 0x21, 0xaa, 0xc1, 0x0c,
+  0x03, 0x67, 0x18, 0xc6, 0xad, 0xc7, 0x12, 0x04, 0xfd, 0xe6, 0xc3, 0xf1, 0x7b, 0x56, 0xaa, 0x3b,
+  0x9c, 0x84, 0x89, 0x51, 0x93, 0xb9, 0x68, 0xa0, 0xa5, 0x31, 0xd4, 0xfe, 0x30, 0x8d, 0xa2, 0xc6,
+  0x74, 0xe2, 0x35, 0xd1, 0x04, 0x5e, 0xcd, 0x86, 0x51, 0x94, 0xb5, 0x76, 0x9f, 0x1d, 0x9b, 0x53,
+  0xd5, 0x47, 0xc5, 0x99, 0x09, 0x48, 0xa8, 0x1f, 0xc2, 0xe1, 0xc8, 0xe9, 0x9a, 0x94, 0x02, 0x7d,
+  0xc8, 0x7e, 0x38, 0x7e, 0xf3, 0x03, 0x73, 0xb3, 0x04, 0x14, 0x34, 0x7b, 0xfb, 0xfe, 0x67, 0x4f,
+  0x33, 0xfe, 0x97, 0xb4, 0x4a, 0x6a, 0x6c, 0xf3, 0x2a, 0x8f, 0xac, 0xe0, 0x6f, 0xd2, 0x1c, 0x15,
+  0xfe, 0x66, 0x18, 0xeb, 0xe7, 0x37, 0xfc, 0xf6, 0xef, 0x34, 0xdd, 0xba, 0xe4, 0x27, 0x9c, 0x72,
+  0x36, 0xac, 0x94, 0x13, 0x5b, 0x68, 0x2d, 0x75, 0xfb, 0xdf, 0x6c, 0x0b, 0x85, 0x35, 0xfe, 0xef,
+  0x7f, 0xa2, 0xb5, 0xaf, 0x6b, 0x2e, 0x75, 0x58, 0x69, 0x5e, 0x17, 0x38, 0xac, 0xcb, 0xdc, 0x87,
+  0x0f, 0x62, 0x9f, 0x63, 0x05, 0xcb, 0xcb, 0xde, 0x11, 0xb9, 0x97, 0xe9, 0x55, 0xda, 0x41, 0xb9,
+  0xdf, 0x02, 0xed, 0xfb, 0xd9, 0x28, 0xe2, 0x99, 0xb1, 0x46, 0xc1, 0xb1, 0xf8, 0xd1, 0x4f, 0x01,
+  0x8b, 0xcf, 0xa2, 0x03, 0xe6, 0xbe, 0x7e, 0x09, 0x06, 0x74, 0x0a, 0x74, 0xf4, 0x23, 0x6f, 0x69,
+  0x68, 0xee, 0xf7, 0xb3, 0x32, 0x8f, 0x91, 0xc6, 0x80, 0x33, 0x70, 0x65, 0x09, 0x0d, 0xf2, 0x90,
+  0x61, 0x39, 0x53, 0xc8, 0xa3, 0x5b, 0xcf, 0xc9, 0x0b, 0x02, 0x43, 0x46, 0xc0, 0x6a, 0x79, 0x14,
+  0x6f, 0x49, 0xd0, 0x8e, 0xf7, 0x3f, 0x8e, 0x92, 0x0c, 0x34, 0x8a, 0x22, 0x05, 0xfb, 0x01, 0x5e,
+  0x81, 0xb3, 0x8e, 0x3f, 0xdc, 0xe5, 0x37, 0xa8, 0xa6, 0x72, 0x8c, 0xe2, 0xd9, 0x70, 0x18, 0x9e,
+  0xed, 0x94, 0xfc, 0x9c, 0xd5, 0x14, 0x1d, 0x80, 0xa5, 0xd3, 0x4b, 0xdd, 0x0f, 0xf0, 0xff, 0xdd,
+  0x3a, 0x4d, 0x55, 0x97, 0x58, 0x88, 0x67, 0xcb, 0x92, 0x79, 0xb6, 0xbb, 0xbb, 0xb3, 0xbb, 0xd0,
+  0x77, 0xb1, 0x5e, 0x26, 0x32, 0x3c, 0x64, 0x06, 0x05, 0x14, 0x2b, 0x99, 0x9e, 0xbf, 0x0e, 0x0c,
+  0xfc, 0x63, 0x65, 0x0d, 0x75, 0xdf, 0xcf, 0xfd, 0xe8, 0xb2, 0x21, 0x17, 0x96, 0x63, 0xc7, 0x00,
+  0xea, 0x97, 0x51, 0x0d, 0xdb, 0xc8, 0x15, 0x03, 0x4c, 0x4e, 0x9e, 0xc5, 0x24, 0xbd, 0xfd, 0x6d,
+  0x80, 0xb6, 0x64, 0xbf, 0x7f, 0x0a, 0xd0, 0x05, 0xfb, 0xcb, 0x20, 0x87, 0xec, 0x10, 0xbd, 0x84,
+  0x52, 0xb0, 0xa3, 0x84, 0x12, 0xd5, 0xc0, 0x11, 0x67, 0xd5, 0x79, 0xae, 0x0f, 0x13, 0x2a, 0x0a,
+  0xd4, 0x04, 0xce, 0x45, 0x60, 0xd3, 0xd8, 0x65, 0xf2, 0xaf, 0xf8, 0x4b, 0x42, 0xee, 0x9d, 0x9f,
+  0x5d, 0xba, 0x0f, 0xb1, 0x33, 0xb1, 0xd7, 0x1d, 0xfb, 0xa3, 0x31, 0xaf, 0xb5, 0x2e, 0x16, 0x2c,
+  0x99, 0x62, 0xec, 0x2f, 0xfc, 0xf8, 0x32, 0x06, 0xc7, 0x36, 0x5e, 0x61, 0xfc, 0xe8, 0x72, 0x2c,
+  0x1f, 0x3f, 0xd5, 0xf8, 0x5a, 0xe3, 0xc7, 0xce, 0x56, 0x1e, 0x7f, 0x1d, 0x1f, 0x4d, 0xa6, 0x51,
+  0xc6, 0x35, 0x1b, 0x2d, 0x94, 0xa9, 0x40, 0x87, 0xb7, 0x00, 0x75, 0x9c, 0x04, 0x18, 0x24, 0x35,
+  0x84, 0xe2, 0xa4, 0xfb, 0x33, 0xd8, 0x1c, 0x6c, 0x76, 0xfb, 0x2b, 0xac, 0x86, 0x78, 0x93, 0xe9,
+  0x5a, 0x30, 0x18, 0x12, 0x68, 0x6c, 0x1a, 0x07, 0x64, 0xee, 0xd8, 0x12, 0x9c, 0x81, 0x53, 0x38,
+  0xe3, 0x29, 0xa8, 0xee, 0x26, 0x7b, 0x05, 0x36, 0xca, 0xf1, 0x18, 0x31, 0xf1, 0x45, 0x78, 0x90,
+  0x6c, 0x9b, 0x21, 0xcf, 0xe4, 0x60, 0x72, 0x84, 0x95, 0x83, 0x02, 0x9c, 0xe6, 0x50, 0x88, 0xfb,
+  0xd7, 0xbc, 0x87, 0xed, 0x7e, 0x86, 0x4e, 0x41, 0x40, 0xa2, 0x19, 0x94, 0x19, 0x1d, 0x87, 0x20,
+  0xa8, 0x2e, 0xd1, 0xe7, 0xd4, 0x96, 0xd1, 0xed, 0xdf, 0x87, 0x40, 0xbe, 0x51, 0x87, 0xc1, 0xdc,
+  0x42, 0x7d, 0x30, 0xa4, 0x70, 0x1b, 0x9c, 0xed, 0xb2, 0x77, 0x61, 0x3c, 0x45, 0x1c, 0x93, 0x11,
+  0x78, 0x52, 0x60, 0xac, 0xcd, 0xa6, 0xe9, 0x80, 0x5d, 0xc1, 0x0c, 0x81, 0xc5, 0xde, 0xcb, 0xf2,
+  0xa5, 0x96, 0xcc, 0xba, 0xd2, 0xb6, 0xbc, 0x67, 0x62, 0x8b, 0xb7, 0x88, 0xfb, 0x69, 0xfc, 0xd1,
+  0xef, 0xf7, 0xf9, 0x24, 0x4f, 0x52, 0x90, 0x72, 0x82, 0x15, 0xb5, 0x9c, 0x93, 0x99, 0xaa, 0x38,
+  0x65, 0xe5, 0xaa, 0xfb, 0xc9, 0x84, 0x14, 0x2d, 0x6d, 0x5c, 0x09, 0x3f, 0x5e, 0x46, 0x0a, 0xf8,
+  0xfe, 0x96, 0xf8, 0x56, 0xae, 0x83, 0x6c, 0xa3, 0x5c, 0xf3, 0xa2, 0xce, 0x96, 0xe8, 0x64, 0x45,
+  0xe9, 0x7c, 0x9f, 0xbd, 0x20, 0x81, 0xba, 0xd8, 0x61, 0x13, 0x8c, 0x53, 0x84, 0xd8, 0x57, 0xdc,
+  0x0e, 0x22, 0x19, 0x5e, 0xec, 0x0c, 0x59, 0x10, 0xd7, 0x5c, 0x6e, 0x35, 0x7b, 0x10, 0x72, 0x21,
+  0x6c, 0x11, 0x58, 0xdc, 0x86, 0x50, 0x64, 0xde, 0x63, 0x8f, 0xdd, 0x87, 0x36, 0xe5, 0x1f, 0x7a,
+  0x4d, 0xea, 0x77, 0x53, 0x50, 0x75, 0x8f, 0x4d, 0xf0, 0xf0, 0xed, 0x51, 0x94, 0xf8, 0xb9, 0xab,
+  0x2b, 0xd3, 0x27, 0x55, 0xd3, 0xc3, 0x4d, 0x8d, 0x13, 0xb1, 0x2e, 0xca, 0x7b, 0x3e, 0x0b, 0xd1,
+  0x35, 0x36, 0x51, 0xd6, 0x43, 0xf8, 0x21, 0x58, 0xc6, 0x0f, 0xe7, 0x94, 0xf5, 0x81, 0x4c, 0x1f,
+  0x2f, 0xdf, 0x65, 0x9a, 0x14, 0xe4, 0xb4, 0xe5, 0xdb, 0xc6, 0x97, 0xc2, 0x0e, 0x4a, 0x26, 0xd1,
+  0xb5, 0xd8, 0xdb, 0x69, 0x82, 0x11, 0x1a, 0xbb, 0xae, 0xc7, 0x0e, 0xba, 0xa0, 0x81, 0xc1, 0x4d,
+  0xc9, 0x46, 0xc2, 0x8a, 0x74, 0x3d, 0xdc, 0x1d, 0x03, 0x3e, 0x4c, 0xc1, 0x34, 0x54, 0x7e, 0x6c,
+  0xc6, 0x28, 0x22, 0x1b, 0x73, 0x10, 0x71, 0x95, 0xf8, 0x60, 0xad, 0x1d, 0x6e, 0x6c, 0x95, 0x2f,
+  0xd5, 0x78, 0x2a, 0x8c, 0x5e, 0x6b, 0xb0, 0x0b, 0x99, 0xc4, 0xb5, 0x11, 0x5d, 0x62, 0xd8, 0x55,
+  0x4c, 0x6b, 0xa1, 0x0c, 0x17, 0xee, 0x05, 0x2d, 0xdb, 0xb3, 0x15, 0x16, 0x6b, 0x59, 0xc1, 0x2f,
+  0xd9, 0x14, 0x2e, 0xf4, 0x85, 0xbd, 0x8a, 0xc4, 0x09, 0x2f, 0xbd, 0x73, 0xaa, 0xe4, 0x86, 0x2d,
+  0x2f, 0x34, 0x32, 0xbf, 0x53, 0x8e, 0x51, 0x5c, 0x91, 0xc8, 0x06, 0xfc, 0xa3, 0x09, 0xb8, 0x4a,
+  0x30, 0x52, 0x36, 0x52, 0x06, 0x9b, 0x7c, 0x5b, 0xb0, 0x71, 0xf3, 0x45, 0xd1, 0xfd, 0x02, 0xf2,
+  0xc8, 0x18, 0x87, 0xcc, 0x1f, 0x90, 0x87, 0xee, 0xc5, 0xcb, 0x12, 0xec, 0xbf, 0xb8, 0x89, 0xb8,
+  0x88, 0xdf, 0x85, 0xb4, 0xe7, 0xff, 0x58, 0x7e, 0x17, 0xc6, 0xcf, 0xff, 0x6b, 0x7e, 0x17, 0xba,
+  0xef, 0x4b, 0x31, 0x10, 0x05, 0xa7, 0xd7, 0xe5, 0x77, 0xb3, 0xd1, 0xd7, 0xe5, 0x77, 0xea, 0xf9,
+  0x9e, 0xfc, 0x5e, 0x62, 0x76, 0x03, 0xd4, 0xff, 0x1d, 0xb3, 0xd7, 0x3d, 0xd6, 0x6d, 0x11, 0xc9,
+  0x54, 0xc8, 0x55, 0x36, 0x89, 0xec, 0xac, 0xc9, 0xfb, 0xc4, 0x2a, 0xea, 0xb2, 0x2c, 0xd7, 0xdf,
+  0x27, 0x92, 0x78, 0x18, 0x5b, 0xa2, 0x7a, 0x14, 0x3f, 0x96, 0xf6, 0xf0, 0xb7, 0x57, 0x8a, 0x17,
+  0xff, 0xee, 0x08, 0x85, 0xea, 0xbf, 0x51, 0x1d, 0xe0, 0xdd, 0xf1, 0x8a, 0x55, 0x7c, 0xfc, 0x7c,
+  0xf8, 0x31, 0x4f, 0x2e, 0x61, 0xed, 0x76, 0x5f, 0x24, 0x39, 0x3b, 0xc5, 0xc7, 0x7a, 0x4f, 0x5f,
+  0x9f, 0xa4, 0x13, 0x53, 0xa6, 0x9a, 0x49, 0xa4, 0x25, 0x8c, 0xf5, 0x3b, 0xef, 0x8f, 0xfc, 0xfc,
+  0x23, 0x1a, 0x0e, 0x2f, 0xe1, 0x81, 0x1d, 0xbf, 0xba, 0x2b, 0xd4, 0x61, 0x34, 0x51, 0x9b, 0x68,
+  0xf0, 0x7a, 0x1c, 0x38, 0xe5, 0xad, 0xfb, 0x32, 0xc1, 0xb2, 0xc6, 0xfb, 0x49, 0x39, 0xf9, 0xeb,
+  0x1f, 0x30, 0x7b, 0xe0, 0xd4, 0x86, 0x83, 0xeb, 0x13, 0x1f, 0xa5, 0x31, 0x7b, 0xc1, 0x43, 0xf6,
+  0x0b, 0xc7, 0x4d, 0x6d, 0xe5, 0x17, 0xf5, 0x4c, 0xac, 0x10, 0x95, 0x75, 0x27, 0xed, 0xfe, 0x38,
+  0x1d, 0x46, 0xe3, 0x24, 0xcb, 0x5f, 0xe3, 0xb1, 0x4d, 0x42, 0xcd, 0x42, 0x64, 0x93, 0xcd, 0x78,
+  0x1c, 0xb3, 0xc3, 0x29, 0x48, 0x30, 0x98, 0x87, 0x01, 0x9e, 0xf2, 0x88, 0x38, 0xf8, 0x6e, 0xe0,
+  0xd9, 0xdd, 0x93, 0xb3, 0x7c, 0xea, 0xef, 0x23, 0x9d, 0x13, 0xfd, 0x98, 0x8f, 0xd0, 0xde, 0x4c,
+  0x22, 0x98, 0xa7, 0x87, 0x47, 0x0a, 0xf8, 0x43, 0x06, 0x0a, 0x72, 0x86, 0xe9, 0x89, 0xcc, 0x95,
+  0x59, 0x2a, 0x72, 0x6b, 0x6d, 0x85, 0x1d, 0x94, 0x05, 0xe0, 0x95, 0x0a, 0x2a, 0x06, 0x7b, 0x5a,
+  0x7c, 0xbb, 0xc7, 0x8e, 0xcf, 0xfd, 0xe9, 0xbd, 0x1a, 0xa5, 0x2f, 0x93, 0xf1, 0x24, 0xe2, 0xf9,
+  0x72, 0x6a, 0xa3, 0x29, 0x81, 0xfe, 0x44, 0x26, 0x33, 0xa6, 0x8a, 0x10, 0x89, 0x16, 0x9d, 0x55,
+  0xff, 0xe1, 0x0b, 0x49, 0xfe, 0x8d, 0xd5, 0x3c, 0x91, 0xba, 0x04, 0xcc, 0x52, 0x20, 0xa5, 0xf0,
+  0x51, 0x14, 0xd6, 0x56, 0xe6, 0xd9, 0x29, 0x3c, 0x6b, 0x4a, 0xb1, 0xac, 0xe2, 0x3f, 0x2d, 0xdc,
+  0xac, 0xfa, 0x49, 0x24, 0xba, 0xaf, 0xa0, 0x68, 0xec, 0x94, 0xf8, 0xfb, 0xe8, 0x19, 0x95, 0x42,
+  0xbf, 0x4a, 0x4a, 0xc2, 0x86, 0x8c, 0xd6, 0xa8, 0x1c, 0x5c, 0x0c, 0xe4, 0x1a, 0xd1, 0x4c, 0x40,
+  0xa6, 0x11, 0x4e, 0x8a, 0x44, 0x6a, 0x4a, 0x6e, 0xea, 0xbe, 0xc3, 0x78, 0x4a, 0xb9, 0xda, 0x38,
+  0x09, 0xb8, 0x55, 0xf1, 0xce, 0xc4, 0x1c, 0x39, 0xd2, 0xf5, 0x12, 0x73, 0x80, 0x85, 0xc2, 0xfe,
+  0xc7, 0x70, 0xa2, 0x73, 0x73, 0xb0, 0x20, 0x03, 0xae, 0x00, 0xcc, 0x99, 0x4b, 0x0c, 0x3a, 0xc0,
+  0xed, 0x9f, 0x57, 0x3f, 0xbc, 0xfc, 0x70, 0x77, 0xce, 0x4d, 0x09, 0x9a, 0xda, 0x87, 0xa5, 0xe2,
+  0xe3, 0xc9, 0x3d, 0x12, 0x6f, 0x86, 0x7e, 0xce, 0x67, 0xfe, 0xb5, 0xc2, 0xee, 0x8d, 0x78, 0xbd,
+  0x0b, 0x0f, 0xbb, 0x95, 0xc4, 0x42, 0x16, 0xde, 0x03, 0x09, 0x58, 0x47, 0x40, 0x5b, 0x4d, 0x21,
+  0x7a, 0xfb, 0x3c, 0xf6, 0xb3, 0x4b, 0x7e, 0x27, 0x41, 0xcc, 0x96, 0x8a, 0x1a, 0x54, 0x76, 0x0f,
+  0x34, 0x82, 0x38, 0x6b, 0x2b, 0x24, 0x5e, 0xfd, 0x74, 0xc2, 0xda, 0xcc, 0x15, 0x21, 0x25, 0x3f,
+  0xba, 0x73, 0x66, 0x8c, 0xb6, 0x6a, 0xe7, 0x19, 0x4a, 0x9c, 0x2f, 0xb2, 0x67, 0xc7, 0x9e, 0xc0,
+  0x72, 0x9c, 0x52, 0x1c, 0x72, 0xed, 0xa4, 0x22, 0x79, 0x38, 0x24, 0x58, 0x69, 0x73, 0xcb, 0x3a,
+  0x5a, 0x72, 0x9f, 0x95, 0xac, 0x8e, 0xa2, 0xb0, 0xdb, 0x5f, 0x41, 0xd2, 0xa4, 0xf7, 0xb1, 0x17,
+  0xb5, 0x49, 0xb4, 0x52, 0x5a, 0x66, 0xcc, 0x67, 0x6a, 0x84, 0x32, 0x33, 0x13, 0x28, 0xc5, 0x33,
+  0xa6, 0x11, 0x71, 0xc1, 0xd4, 0x6f, 0xb2, 0xa7, 0x77, 0x64, 0x8b, 0xd9, 0x76, 0x58, 0x05, 0xa8,
+  0xf2, 0x6d, 0x74, 0x2d, 0x00, 0xaa, 0xb6, 0x81, 0x9e, 0xfe, 0xce, 0x3c, 0x6d, 0x8d, 0xe9, 0xfa,
+  0x09, 0x05, 0x68, 0x10, 0x65, 0x4b, 0xf3, 0x6c, 0xb1, 0xc2, 0x7d, 0xe6, 0xd1, 0x38, 0xda, 0x53,
+  0x3f, 0x81, 0xb5, 0x7e, 0xf7, 0x23, 0xed, 0x5b, 0x63, 0x8e, 0x84, 0x7e, 0xb1, 0xf6, 0x8b, 0x17,
+  0x24, 0x24, 0xeb, 0x3c, 0xf2, 0xab, 0x24, 0x05, 0x1a, 0x6c, 0xa1, 0xce, 0xa2, 0xc3, 0x1d, 0xf2,
+  0xbb, 0x0c, 0x72, 0xb1, 0x2d, 0x26, 0xdd, 0x7f, 0x78, 0x7a, 0xe7, 0xc7, 0xa8, 0x02, 0xe0, 0x89,
+  0xb6, 0x1c, 0x97, 0xe7, 0x32, 0x23, 0x25, 0x1a, 0xf8, 0x5a, 0xb3, 0x35, 0x2c, 0xe7, 0xab, 0xa8,
+  0x37, 0x4e, 0x52, 0xee, 0xac, 0xa5, 0x97, 0xcb, 0x6a, 0x79, 0x80, 0x27, 0x84, 0x69, 0x7e, 0x5c,
+  0x02, 0xf9, 0x92, 0x0e, 0x1f, 0x83, 0x42, 0xbe, 0xfd, 0xcf, 0x28, 0x07, 0xef, 0x82, 0x45, 0x7e,
+  0x50, 0xc9, 0x02, 0xaf, 0x99, 0x62, 0x3c, 0xeb, 0xb4, 0x6c, 0x86, 0xf1, 0x4c, 0xd4, 0x7d, 0x26,
+  0xf8, 0x2d, 0x9e, 0x46, 0x17, 0x07, 0xa9, 0x96, 0xa8, 0xd9, 0x15, 0x16, 0x20, 0x20, 0xf0, 0x31,
+  0xe2, 0x57, 0x68, 0xbe, 0x01, 0xb8, 0xc6, 0x5b, 0x7c, 0xac, 0x0d, 0xf6, 0xeb, 0x7a, 0x48, 0xa4,
+  0x11, 0x1e, 0x35, 0xb0, 0x0e, 0x18, 0x88, 0xc5, 0x0f, 0xb5, 0xa8, 0x12, 0x9a, 0x2f, 0xf4, 0x20,
+  0x83, 0xd1, 0xc7, 0x71, 0xee, 0xe6, 0xa3, 0x30, 0x53, 0x81, 0xea, 0x76, 0x8b, 0x42, 0xd0, 0x75,
+  0x91, 0x7e, 0xbd, 0x23, 0x64, 0x5c, 0x7f, 0x01, 0xb8, 0x01, 0xb9, 0x69, 0xbc, 0xcd, 0x66, 0xd3,
+  0x70, 0xb0, 0x17, 0x50, 0xfd, 0xfd, 0xe9, 0xa1, 0x3c, 0xdd, 0xb5, 0x8c, 0xf6, 0xd5, 0xc3, 0x61,
+  0xf7, 0xca, 0x65, 0x37, 0x0f, 0x93, 0x31, 0x17, 0xba, 0xf6, 0x16, 0x2d, 0x3a, 0xcc, 0x26, 0x96,
+  0x47, 0xc5, 0xd8, 0x28, 0xe9, 0x8f, 0x88, 0x87, 0x98, 0xdb, 0xec, 0x85, 0x31, 0x7b, 0x05, 0xad,
+  0x43, 0xb9, 0xd1, 0x47, 0xd2, 0x55, 0x61, 0x88, 0x2f, 0x25, 0xd3, 0x7a, 0x10, 0x46, 0x3a, 0xd6,
+  0x21, 0x06, 0xe0, 0x30, 0x11, 0x5e, 0x3a, 0x70, 0x10, 0x98, 0x29, 0xd1, 0xf0, 0x24, 0x1a, 0xfd,
+  0x5b, 0x47, 0xa6, 0xc9, 0xc1, 0x64, 0xa5, 0x1d, 0x82, 0x45, 0xf2, 0x6c, 0x7f, 0x0b, 0x4f, 0xa3,
+  0xc9, 0xc3, 0xe3, 0x64, 0x80, 0xe3, 0x81, 0x78, 0xad, 0x3b, 0xf7, 0xc5, 0xe1, 0xbd, 0xee, 0x46,
+  0x5f, 0x64, 0xc4, 0xbc, 0xfe, 0xcb, 0xeb, 0xb7, 0x1f, 0x7f, 0x3a, 0x7c, 0xf7, 0xfa, 0x84, 0x1d,
+  0xb0, 0x33, 0xe7, 0x88, 0x8f, 0x22, 0xba, 0x7f, 0xd2, 0xf9, 0xd9, 0x4f, 0x63, 0xb2, 0x1d, 0xf1,
+  0xe5, 0x38, 0x1e, 0x24, 0xf8, 0xfb, 0x15, 0xef, 0x4d, 0x87, 0xce, 0x79, 0x67, 0x23, 0xe2, 0x62,
+  0xff, 0x8d, 0x43, 0xab, 0x78, 0x1a, 0x45, 0x9b, 0x4c, 0x30, 0x9d, 0x7c, 0xed, 0x6c, 0x0c, 0xa6,
+  0xb1, 0x98, 0xdc, 0xc7, 0x6e, 0x18, 0x78, 0xec, 0x06, 0xa8, 0x90, 0x4f, 0x41, 0xfb, 0x06, 0x49,
+  0x7f, 0x8a, 0xb1, 0xbc, 0xe6, 0x90, 0xe7, 0xaf, 0x23, 0x8e, 0x8f, 0x2f, 0xae, 0x8f, 0x03, 0xac,
+  0x84, 0x07, 0xe1, 0x75, 0x33, 0x10, 0x69, 0x6e, 0xdf, 0x68, 0xe7, 0xf6, 0x41, 0x34, 0xb5, 0x5b,
+  0x2d, 0xaf, 0x99, 0x27, 0x47, 0x78, 0xa0, 0xdf, 0xdd, 0xb6, 0x1b, 0x94, 0x4e, 0xb3, 0xe3, 0x2d,
+  0x02, 0xaa, 0xab, 0xbf, 0x4e, 0x79, 0x7a, 0x2d, 0x52, 0xeb, 0x92, 0xd4, 0x75, 0xd4, 0x3d, 0x12,
+  0x8e, 0xd7, 0x24, 0x9a, 0xbf, 0x05, 0x9f, 0xa6, 0x29, 0x9a, 0xbb, 0x8e, 0x3c, 0x54, 0x5e, 0x86,
+  0x0d, 0x24, 0x74, 0xd1, 0x3e, 0xd9, 0x64, 0xc9, 0xa5, 0xb8, 0xd8, 0x42, 0xd0, 0x2f, 0x87, 0x01,
+  0x3f, 0x76, 0x25, 0x8d, 0xbd, 0x0e, 0xde, 0x61, 0xd0, 0xc4, 0x7a, 0x2f, 0xe5, 0xad, 0x13, 0x07,
+  0x74, 0x03, 0x89, 0x28, 0x27, 0xb6, 0x6d, 0x16, 0x77, 0x30, 0xc0, 0xc7, 0xe4, 0x92, 0x7d, 0xcf,
+  0x1c, 0xfb, 0x66, 0x11, 0x87, 0xed, 0xa9, 0x22, 0x71, 0x57, 0x88, 0x63, 0x36, 0x97, 0x4c, 0x0f,
+  0x6d, 0x1d, 0xba, 0x1c, 0x81, 0x3e, 0xf6, 0x71, 0x2b, 0x45, 0x6e, 0x8b, 0xb8, 0x80, 0x00, 0x3c,
+  0xa5, 0x0a, 0x19, 0x7c, 0x86, 0xda, 0x19, 0x57, 0x69, 0x85, 0x72, 0x83, 0xe5, 0xa6, 0x0e, 0x24,
+  0x2e, 0x25, 0x07, 0x86, 0xbe, 0x89, 0xf7, 0x6e, 0xb4, 0x00, 0x84, 0x41, 0x84, 0xab, 0x30, 0x0b,
+  0x41, 0xc2, 0xcb, 0xe9, 0x14, 0xc3, 0xcf, 0x68, 0xf8, 0x34, 0x77, 0x72, 0x9e, 0x32, 0xf6, 0xe4,
+  0x09, 0xcb, 0x4a, 0x90, 0x1f, 0x1c, 0x18, 0xb0, 0x0b, 0x88, 0xe6, 0xe9, 0x50, 0xc9, 0xbf, 0xc7,
+  0x81, 0xa0, 0x6e, 0xfd, 0xdc, 0x1d, 0x46, 0x11, 0x4c, 0x5f, 0x59, 0x1e, 0x78, 0x78, 0xef, 0xc4,
+  0x6b, 0xd0, 0x71, 0x6e, 0x86, 0x03, 0xcb, 0x16, 0x0c, 0x8b, 0x08, 0x22, 0x67, 0x8d, 0x8e, 0x7b,
+  0x2a, 0x69, 0x84, 0x43, 0x28, 0xba, 0xc7, 0x5a, 0xe1, 0x80, 0xb9, 0x56, 0x1d, 0x1c, 0xb1, 0x55,
+  0xb0, 0x70, 0x36, 0xe8, 0x1e, 0x8b, 0x65, 0xd8, 0xeb, 0x53, 0xb2, 0x05, 0xda, 0x11, 0xa2, 0x1d,
+  0x19, 0xcc, 0x08, 0xfa, 0x2f, 0xb9, 0x32, 0x98, 0x91, 0x90, 0xc2, 0x25, 0x27, 0x0a, 0xde, 0xe2,
+  0xed, 0x07, 0x07, 0x8b, 0xf8, 0xfb, 0x42, 0x77, 0x71, 0x26, 0x35, 0xe8, 0x1f, 0x4a, 0x07, 0x71,
+  0x1f, 0xdf, 0xe8, 0xe1, 0xce, 0x1f, 0x7a, 0xce, 0xf9, 0x85, 0x1e, 0x74, 0x01, 0xdf, 0x33, 0xfa,
+  0x32, 0x30, 0xf3, 0x83, 0xc0, 0x58, 0x23, 0xb2, 0xd5, 0x2c, 0x8c, 0x83, 0x64, 0xd6, 0x0c, 0xe3,
+  0x98, 0xa7, 0x3f, 0xe3, 0x35, 0x1a, 0x6c, 0xff, 0x00, 0xef, 0x80, 0x41, 0x56, 0x58, 0x6b, 0x11,
+  0xe2, 0xcc, 0x82, 0xf0, 0xca, 0x8c, 0x91, 0x23, 0xe1, 0xed, 0x95, 0x2d, 0x48, 0x0c, 0xfa, 0x0b,
+  0xe0, 0x5c, 0x03, 0xa9, 0xe8, 0xb4, 0x1f, 0x3a, 0x82, 0xdc, 0x15, 0x92, 0xc8, 0x41, 0x49, 0xf5,
+  0xc8, 0x61, 0xdf, 0xb0, 0xea, 0xac, 0xea, 0x12, 0x76, 0x80, 0x3c, 0x49, 0x1a, 0x1f, 0xfb, 0x20,
+  0x13, 0x03, 0x55, 0x9a, 0x82, 0x5f, 0x53, 0x59, 0x1a, 0x80, 0xc8, 0xdf, 0x85, 0x15, 0x42, 0x9f,
+  0xb0, 0x5f, 0x0d, 0x45, 0x18, 0x2a, 0xad, 0xc5, 0x70, 0xcc, 0x9c, 0x54, 0xdd, 0x0a, 0xf3, 0x59,
+  0x97, 0x75, 0x6e, 0x9c, 0x13, 0xfe, 0xdb, 0xdf, 0x58, 0x19, 0x33, 0xeb, 0x08, 0x58, 0xf5, 0x7b,
+  0x25, 0x7c, 0x5d, 0xad, 0x52, 0x4a, 0xc6, 0x13, 0x92, 0x97, 0xb6, 0x60, 0x05, 0x69, 0x3d, 0x71,
+  0xbd, 0x8a, 0x5e, 0xbb, 0xb0, 0x14, 0xfe, 0x98, 0x01, 0x33, 0x4d, 0xd3, 0x48, 0xac, 0x58, 0xb9,
+  0xfe, 0x69, 0x30, 0x58, 0xba, 0x89, 0x42, 0x02, 0xb8, 0x9b, 0xef, 0xe1, 0xfa, 0x6b, 0xe0, 0x6c,
+  0x81, 0x66, 0x54, 0x9b, 0xbc, 0x29, 0x89, 0x20, 0xb2, 0x31, 0x70, 0xb0, 0xa9, 0xbc, 0xfe, 0x88,
+  0x70, 0x79, 0xda, 0x6a, 0x63, 0xf7, 0xb0, 0x9e, 0x28, 0x94, 0x0d, 0x53, 0x1c, 0x25, 0x7e, 0x80,
+  0x18, 0xe4, 0xa3, 0x34, 0x99, 0x31, 0xf0, 0x28, 0xd8, 0x6b, 0x94, 0x8c, 0xae, 0x03, 0x55, 0x1d,
+  0x49, 0x33, 0x8d, 0x41, 0xda, 0xfc, 0x05, 0x11, 0xa3, 0x29, 0x9f, 0xdb, 0x22, 0x0c, 0x4d, 0xa4,
+  0x89, 0x8f, 0x57, 0x5a, 0xa2, 0xcd, 0x5a, 0x83, 0xb7, 0xf8, 0x78, 0xc3, 0xc6, 0x3c, 0x1f, 0x25,
+  0x01, 0x60, 0xfe, 0xe1, 0xfd, 0xc9, 0x29, 0xb0, 0x93, 0xb8, 0x76, 0x25, 0xdb, 0x83, 0x4f, 0x8e,
+  0x14, 0xed, 0x8d, 0x53, 0xd0, 0xde, 0x0e, 0x54, 0xc1, 0x0d, 0xec, 0x50, 0xa0, 0xba, 0x85, 0x3d,
+  0x3b, 0x28, 0x3e, 0x11, 0xfe, 0x1e, 0xfb, 0xe3, 0xc9, 0xfb, 0x9f, 0x60, 0x64, 0x69, 0x18, 0x0f,
+  0xc3, 0xc1, 0xb5, 0x2b, 0x3a, 0x9d, 0x7b, 0x84, 0x6d, 0x85, 0x0e, 0x6b, 0x51, 0x42, 0x62, 0x4d,
+  0xba, 0x56, 0x0e, 0xbf, 0x42, 0x80, 0x26, 0xb4, 0x82, 0x31, 0x09, 0x71, 0xef, 0xde, 0x80, 0xb2,
+  0xd9, 0x83, 0x6f, 0xa0, 0x72, 0xe6, 0x42, 0xa0, 0x30, 0x1b, 0x95, 0xa0, 0x8c, 0xca, 0x03, 0x90,
+  0xc5, 0x4a, 0x6b, 0x77, 0x64, 0xb9, 0xd0, 0x84, 0x41, 0x93, 0x14, 0x17, 0xfc, 0x56, 0x37, 0x74,
+  0x01, 0x43, 0x39, 0x6f, 0x8a, 0xdc, 0x9c, 0x26, 0x30, 0xd0, 0x1e, 0x73, 0xa5, 0x39, 0x01, 0x44,
+  0x82, 0xc5, 0x08, 0xb5, 0xc5, 0xdd, 0x58, 0x58, 0xf7, 0xcf, 0x71, 0x8f, 0xd3, 0x91, 0x3a, 0x58,
+  0xe2, 0x9b, 0x0c, 0xe1, 0x79, 0x1d, 0xa3, 0x6b, 0x2a, 0xa8, 0x61, 0x41, 0xfc, 0x86, 0x73, 0xd4,
+  0xa4, 0xfb, 0x73, 0xde, 0x0f, 0x5c, 0xcb, 0xdb, 0x85, 0x4e, 0x91, 0x6a, 0x2d, 0xaf, 0x9c, 0x3d,
+  0x50, 0x21, 0x51, 0x60, 0x8f, 0xdf, 0x24, 0x94, 0x18, 0xa1, 0xc6, 0xfc, 0x47, 0xf2, 0x8f, 0xc0,
+  0x85, 0x03, 0x53, 0x2e, 0x00, 0x7b, 0x08, 0x98, 0x61, 0xe0, 0x47, 0x19, 0xf7, 0x6c, 0xce, 0x42,
+  0x5b, 0x8c, 0xd6, 0x03, 0x3e, 0x98, 0x06, 0x02, 0x39, 0x4d, 0x07, 0xec, 0x66, 0x8e, 0x3d, 0xe2,
+  0xc7, 0x1a, 0x9d, 0x20, 0xae, 0x03, 0x44, 0x13, 0x52, 0xdf, 0x01, 0x28, 0xde, 0x0c, 0x1d, 0xc1,
+  0x23, 0x7b, 0xc5, 0xf0, 0xa8, 0x89, 0xe6, 0xa3, 0x58, 0xbc, 0x3a, 0xbc, 0xeb, 0x51, 0x7f, 0x67,
+  0xf0, 0x91, 0xda, 0x43, 0xc7, 0xf0, 0x48, 0x5f, 0xb9, 0x1c, 0x32, 0x07, 0xdc, 0xab, 0x00, 0x64,
+  0xd8, 0xba, 0xb6, 0xb9, 0xb8, 0xbd, 0x96, 0xaa, 0x39, 0x30, 0xe9, 0xc8, 0x72, 0xcc, 0x4a, 0x6b,
+  0x51, 0x75, 0x3c, 0xa3, 0x87, 0x45, 0x70, 0xd4, 0xa2, 0xd4, 0x33, 0x81, 0x15, 0x6d, 0x4a, 0x86,
+  0x51, 0x74, 0x04, 0x74, 0x72, 0x33, 0x49, 0x22, 0x99, 0x49, 0x93, 0x99, 0x54, 0x25, 0xa3, 0x7c,
+  0xa1, 0x06, 0x54, 0x2d, 0xa9, 0x9f, 0xf7, 0xbd, 0x5f, 0xe0, 0xa5, 0x79, 0xc9, 0xaf, 0x33, 0x57,
+  0x02, 0xd2, 0x44, 0xbd, 0x2c, 0x68, 0x2a, 0xe0, 0x22, 0x95, 0x6b, 0x66, 0xc9, 0xbd, 0x38, 0x13,
+  0x06, 0xfe, 0xe3, 0x9b, 0xcb, 0xb9, 0xd2, 0x97, 0x72, 0x91, 0xf0, 0x48, 0xad, 0x92, 0xce, 0x9d,
+  0x93, 0x53, 0x4c, 0x06, 0x74, 0xf3, 0xe0, 0x81, 0x40, 0xe7, 0xec, 0xf2, 0xbc, 0x23, 0x88, 0x56,
+  0x10, 0x9b, 0x15, 0x9f, 0xaa, 0x52, 0x0c, 0xb3, 0xdb, 0x78, 0x2a, 0xd7, 0x84, 0x41, 0x14, 0x34,
+  0xc6, 0xc8, 0x26, 0x2f, 0x0c, 0x1d, 0x10, 0x97, 0x58, 0x7a, 0x06, 0x7c, 0x45, 0xc7, 0x3f, 0xc5,
+  0x8b, 0xb6, 0x26, 0xd4, 0x35, 0x0e, 0x50, 0xda, 0xc2, 0x42, 0x30, 0x9d, 0x50, 0x93, 0x68, 0xfa,
+  0xb8, 0xf8, 0xba, 0xc9, 0x42, 0xaf, 0x4c, 0x27, 0x02, 0x86, 0xdd, 0xc1, 0xf7, 0xb3, 0xd6, 0xb9,
+  0x61, 0x93, 0x6f, 0x32, 0x25, 0xbf, 0xc4, 0xc7, 0xf6, 0x79, 0xc7, 0x68, 0x27, 0xae, 0xd5, 0x3c,
+  0x60, 0x86, 0x8c, 0xdb, 0x06, 0x9e, 0x3a, 0x13, 0xb2, 0x23, 0x4d, 0x73, 0x54, 0xdd, 0xe6, 0x4d,
+  0xa1, 0xce, 0x39, 0xdb, 0x33, 0x6b, 0xb7, 0xa9, 0xf6, 0x5b, 0x2e, 0x7c, 0x14, 0xe3, 0x86, 0x4f,
+  0xaa, 0x78, 0xe6, 0x14, 0x77, 0x5a, 0xe0, 0x77, 0xeb, 0x36, 0x4f, 0xe7, 0xbc, 0x98, 0x20, 0x03,
+  0x22, 0x48, 0x0b, 0x4d, 0x87, 0x6f, 0xbe, 0x11, 0x55, 0x90, 0x6c, 0xcd, 0xc9, 0x34, 0x1b, 0xb9,
+  0x17, 0x22, 0x1c, 0x13, 0x74, 0x1f, 0x3d, 0xbe, 0x09, 0x41, 0x88, 0xb5, 0xe7, 0xfb, 0x5b, 0x79,
+  0x40, 0x25, 0xd6, 0xd9, 0x64, 0x31, 0xb0, 0xc7, 0x37, 0xf4, 0x1b, 0x06, 0x3d, 0x77, 0xba, 0xea,
+  0xa5, 0x75, 0x3e, 0xd7, 0x71, 0x71, 0xd9, 0xf4, 0xf1, 0x0d, 0x11, 0xd0, 0x80, 0xb5, 0xc2, 0x71,
+  0x7e, 0x79, 0xe1, 0xaa, 0xd3, 0xbd, 0x60, 0xdf, 0x48, 0x69, 0x76, 0xb1, 0x60, 0xd7, 0x03, 0xaf,
+  0x83, 0x75, 0x18, 0xfd, 0x0d, 0x08, 0xe4, 0xd9, 0x12, 0xb5, 0x9d, 0xd7, 0x71, 0x4e, 0xd4, 0xc6,
+  0xcd, 0x51, 0x90, 0xcd, 0x27, 0xf2, 0x79, 0xbe, 0xe4, 0x00, 0x3e, 0xce, 0x09, 0xc6, 0x11, 0xf0,
+  0x6d, 0x0f, 0xc6, 0x19, 0xce, 0x31, 0x64, 0x50, 0x05, 0xfd, 0xe4, 0x51, 0x7b, 0xfb, 0xf9, 0xf6,
+  0xb7, 0x4f, 0x3b, 0x04, 0x59, 0xbe, 0xed, 0x76, 0x9c, 0xb9, 0xf6, 0x5b, 0xd7, 0xc4, 0x1e, 0xf7,
+  0x5c, 0xe4, 0x59, 0x95, 0x15, 0xee, 0x07, 0xb0, 0xd1, 0x7b, 0xf2, 0xe8, 0xbb, 0xe7, 0xcf, 0xbf,
+  0xeb, 0xdc, 0xb7, 0xeb, 0x43, 0x7d, 0xa5, 0xc1, 0x4a, 0x57, 0x22, 0x94, 0xfb, 0xc6, 0xa1, 0x3f,
+  0x6b, 0x75, 0x2a, 0x61, 0x29, 0x9c, 0x6e, 0x0c, 0xac, 0x29, 0x29, 0x22, 0x16, 0xa6, 0x62, 0xb7,
+  0x75, 0x4e, 0xdc, 0x53, 0xcb, 0xd5, 0x42, 0xbb, 0x54, 0x15, 0x71, 0x93, 0x47, 0x19, 0x35, 0x3b,
+  0xb3, 0x72, 0x0c, 0xb1, 0x26, 0xa0, 0x6b, 0xe7, 0xce, 0x60, 0xdf, 0x3a, 0x6f, 0x46, 0x80, 0x5c,
+  0xe9, 0xba, 0x8e, 0x02, 0x05, 0x15, 0x01, 0x26, 0xf4, 0x0b, 0x48, 0x62, 0x4d, 0xfc, 0xde, 0x08,
+  0x30, 0x0d, 0xe7, 0x8e, 0xf0, 0xef, 0x85, 0x57, 0xe8, 0x21, 0xf0, 0xde, 0x4b, 0x77, 0xda, 0x78,
+  0x25, 0x0f, 0xbe, 0x10, 0x93, 0xdf, 0x30, 0x67, 0x8b, 0xfc, 0x0a, 0x29, 0x27, 0x45, 0xd8, 0xda,
+  0x84, 0x22, 0x2f, 0x55, 0xf1, 0x84, 0x33, 0xf4, 0xc3, 0xe9, 0xbb, 0xb7, 0x28, 0xed, 0x9a, 0xa2,
+  0xd8, 0x10, 0x93, 0x08, 0x8a, 0x09, 0x9a, 0x3b, 0x66, 0x7b, 0x79, 0xaf, 0x4c, 0x19, 0x85, 0xac,
+  0x29, 0x3e, 0xbc, 0x0b, 0x63, 0x6a, 0x39, 0x0e, 0x63, 0xdd, 0xac, 0xb8, 0x58, 0xc2, 0xee, 0x95,
+  0x84, 0xd8, 0x2f, 0x49, 0x18, 0xbb, 0x8e, 0xe9, 0xfb, 0x0e, 0x40, 0x67, 0x66, 0xa4, 0x80, 0xb4,
+  0xf6, 0x14, 0xce, 0x96, 0x8c, 0xc6, 0x58, 0x4e, 0x9b, 0xf5, 0x05, 0x1c, 0xb5, 0x24, 0xe3, 0x68,
+  0x1c, 0x3d, 0x32, 0xee, 0x12, 0xd0, 0xae, 0xd5, 0x03, 0x09, 0xd9, 0x43, 0xac, 0xcc, 0x0a, 0x16,
+  0x56, 0x92, 0xdb, 0x4d, 0xbc, 0xc8, 0xe0, 0xab, 0xc7, 0x05, 0x03, 0x07, 0x00, 0xcd, 0xbe, 0xc4,
+  0xc1, 0xf3, 0x6a, 0xca, 0xb4, 0xe6, 0xac, 0xce, 0x4d, 0x11, 0xa9, 0xc9, 0x9a, 0xca, 0x13, 0x2a,
+  0xca, 0x23, 0x2a, 0xa7, 0x5c, 0xd4, 0x4d, 0x46, 0xbf, 0x88, 0x38, 0x51, 0x33, 0xf3, 0x71, 0xdf,
+  0x3b, 0x03, 0xf9, 0x0d, 0x24, 0x2f, 0x5e, 0x85, 0x42, 0x03, 0x04, 0xac, 0xac, 0x58, 0x7b, 0x90,
+  0x6e, 0xa4, 0xee, 0x28, 0xfd, 0x9e, 0x5d, 0xe0, 0xf5, 0x20, 0x57, 0x28, 0x18, 0xb0, 0x50, 0xa4,
+  0x9d, 0x09, 0xc5, 0x83, 0xf2, 0x52, 0x84, 0xe2, 0x85, 0x18, 0xa6, 0x58, 0xbc, 0x33, 0x67, 0x9f,
+  0xa7, 0xf5, 0x95, 0x31, 0x24, 0xa6, 0x4c, 0x2d, 0x68, 0x20, 0x1f, 0x0d, 0xa6, 0x9a, 0x4b, 0x8e,
+  0x52, 0x72, 0x0e, 0x6a, 0xc3, 0x2a, 0xc9, 0x3f, 0x50, 0x16, 0x19, 0xa2, 0xc2, 0x9e, 0x8c, 0x61,
+  0x29, 0x27, 0x79, 0x07, 0xfa, 0x00, 0x03, 0xe0, 0x73, 0x4e, 0x1d, 0x15, 0x75, 0xe6, 0x32, 0xe3,
+  0x9e, 0x5f, 0x20, 0x42, 0x45, 0xed, 0x19, 0x86, 0x1e, 0xf1, 0x8a, 0x17, 0x95, 0x0e, 0x4f, 0xe6,
+  0xbd, 0x73, 0x1c, 0x53, 0x82, 0x0f, 0xbc, 0x88, 0xfe, 0x0c, 0xf8, 0x7f, 0x01, 0x6f, 0x16, 0x63,
+  0xaa, 0x43, 0x95, 0xad, 0xbb, 0xc7, 0xd4, 0xae, 0x03, 0x76, 0x99, 0x4d, 0x87, 0x43, 0xbc, 0xba,
+  0x25, 0x40, 0xea, 0xa2, 0x3f, 0xd0, 0x80, 0x71, 0x8f, 0xb3, 0x4d, 0xbd, 0x21, 0x61, 0x57, 0x6a,
+  0x9b, 0x95, 0x2e, 0x74, 0x6f, 0xee, 0x3b, 0x50, 0xee, 0x14, 0xa3, 0x14, 0xe4, 0xa5, 0xab, 0x48,
+  0x81, 0x28, 0x27, 0x7a, 0xe6, 0xe6, 0x5b, 0x75, 0xe5, 0xa0, 0x9e, 0xe9, 0xcf, 0x4d, 0x04, 0x4d,
+  0x6a, 0x06, 0x4f, 0xf2, 0xcb, 0xdc, 0x33, 0x48, 0x87, 0x4e, 0x05, 0xc8, 0xfc, 0x1c, 0x09, 0x87,
+  0x51, 0x5b, 0xac, 0xaa, 0xca, 0x34, 0xa1, 0x58, 0x06, 0x60, 0x18, 0x0c, 0x15, 0x43, 0x96, 0x80,
+  0xf8, 0x98, 0xf9, 0x68, 0x9c, 0xc1, 0x30, 0x29, 0x91, 0xee, 0xf3, 0x74, 0xc8, 0x93, 0x34, 0x88,
+  0xf1, 0xb8, 0xe6, 0xdd, 0xda, 0x67, 0xc9, 0x9d, 0x41, 0xcb, 0x32, 0xba, 0xc9, 0xfb, 0x49, 0xc7,
+  0x94, 0xd5, 0x7d, 0xfb, 0x3f, 0x78, 0xc7, 0x4d, 0x7f, 0x04, 0x52, 0xb0, 0x67, 0x04, 0x8b, 0x69,
+  0x3e, 0xc5, 0x6a, 0x3b, 0x13, 0xb9, 0xbd, 0x60, 0x1d, 0x51, 0xce, 0xe3, 0x79, 0x61, 0xec, 0xf9,
+  0x75, 0x96, 0x5e, 0x20, 0xe4, 0x17, 0x9d, 0x62, 0x39, 0x0b, 0xa5, 0x09, 0xf5, 0xd8, 0xbd, 0x90,
+  0xe7, 0x5a, 0x1e, 0xdf, 0xf8, 0x73, 0xb9, 0x06, 0x2e, 0xec, 0x35, 0x70, 0xf1, 0xf8, 0x06, 0xbc,
+  0x38, 0x71, 0x17, 0x2c, 0x30, 0xfa, 0x7b, 0x69, 0xd0, 0x00, 0x1e, 0xef, 0x07, 0x03, 0x7a, 0x9e,
+  0x17, 0xec, 0x72, 0xd8, 0x1b, 0xf2, 0x59, 0xc8, 0x33, 0x31, 0x93, 0x01, 0x38, 0xba, 0x68, 0xb4,
+  0xf3, 0xc0, 0xa8, 0x02, 0x96, 0x5d, 0x84, 0xe7, 0x57, 0x39, 0xf8, 0xfe, 0x3c, 0x1c, 0xc6, 0x61,
+  0x86, 0x7f, 0xf0, 0x02, 0x2b, 0x83, 0x54, 0xca, 0xe7, 0x17, 0x85, 0x44, 0x97, 0xa6, 0x26, 0x21,
+  0x1e, 0x6e, 0xf7, 0xe5, 0x72, 0x35, 0xee, 0x63, 0x29, 0x21, 0x2a, 0xac, 0x0b, 0x0a, 0xae, 0x20,
+  0xc0, 0x5e, 0x05, 0x6b, 0xf0, 0xc9, 0xc2, 0x9c, 0x7c, 0xd8, 0x77, 0xe8, 0x7b, 0x0e, 0xa2, 0x04,
+  0x5c, 0x82, 0x1e, 0x88, 0xe4, 0x13, 0x8e, 0x51, 0xe9, 0x67, 0x2d, 0x4f, 0x0b, 0xe5, 0x05, 0xe3,
+  0x7b, 0x01, 0xc2, 0x38, 0xc6, 0x9c, 0x75, 0xd1, 0x41, 0x4f, 0xbd, 0x9a, 0x24, 0xd0, 0x07, 0x71,
+  0xe9, 0xdc, 0xc9, 0x9f, 0x6e, 0x7f, 0xeb, 0x5f, 0xe2, 0x49, 0xdf, 0x29, 0xde, 0x42, 0x8b, 0x8d,
+  0x52, 0xee, 0x07, 0x18, 0x3c, 0x9e, 0x23, 0x33, 0xea, 0x45, 0x70, 0xbc, 0xfd, 0x72, 0x8f, 0xfd,
+  0x1c, 0x72, 0x60, 0xba, 0x51, 0x12, 0xe9, 0xc5, 0x80, 0xd5, 0xf3, 0x34, 0xe4, 0x66, 0x0f, 0x2f,
+  0xa6, 0x59, 0x43, 0xd6, 0xa4, 0x3b, 0x40, 0x22, 0xbb, 0x7a, 0x1f, 0x6f, 0xd9, 0xb5, 0x5b, 0xa0,
+  0x13, 0x4c, 0x87, 0x6b, 0x60, 0x21, 0xab, 0x8a, 0x03, 0x50, 0x86, 0x30, 0x31, 0x17, 0x92, 0xac,
+  0xe5, 0x13, 0x6f, 0x65, 0xcd, 0xf5, 0x00, 0x98, 0x47, 0x56, 0x69, 0xca, 0xbc, 0x41, 0x24, 0xec,
+  0x2b, 0xae, 0x72, 0x03, 0x73, 0xa4, 0x99, 0x51, 0xa9, 0x20, 0x3e, 0x3a, 0xdd, 0xd3, 0x38, 0x90,
+  0x56, 0xaa, 0x38, 0xee, 0x7a, 0xa5, 0xcb, 0x8a, 0x99, 0x96, 0x2d, 0x0a, 0x3e, 0x6d, 0x8e, 0xfd,
+  0x89, 0x08, 0x67, 0x28, 0x0e, 0xf4, 0x84, 0xc2, 0xd1, 0xea, 0x46, 0x1c, 0xe5, 0x92, 0xb3, 0xfb,
+  0x40, 0x46, 0xf0, 0x50, 0xf3, 0x25, 0x45, 0x91, 0x59, 0xa7, 0x26, 0xa2, 0xb0, 0xb5, 0xc5, 0x30,
+  0x02, 0x24, 0xee, 0x2c, 0xce, 0x18, 0x6e, 0x23, 0xe1, 0x0c, 0xb1, 0xd9, 0x08, 0x13, 0x1f, 0x99,
+  0xf8, 0xfb, 0x69, 0x80, 0xe1, 0x18, 0x3e, 0x0a, 0xa8, 0x88, 0xb0, 0xd9, 0xef, 0x81, 0x2c, 0x57,
+  0x48, 0x49, 0xe5, 0x23, 0x65, 0x91, 0x85, 0x96, 0xd2, 0x4b, 0x58, 0x66, 0x57, 0xab, 0x62, 0x46,
+  0xce, 0x9d, 0x05, 0x49, 0xb7, 0x91, 0x73, 0x56, 0x4e, 0xc9, 0x2a, 0xad, 0x87, 0x9f, 0x51, 0xda,
+  0xd3, 0xa4, 0x03, 0x7b, 0xe0, 0xa4, 0x93, 0x7f, 0x3d, 0xe5, 0x28, 0x4c, 0xe5, 0xe3, 0x3b, 0xff,
+  0x93, 0xc1, 0x26, 0x6f, 0x38, 0xe5, 0x42, 0xe5, 0xa2, 0x2e, 0x3c, 0xe7, 0xc6, 0xc7, 0x2a, 0x6f,
+  0xe6, 0x35, 0xbc, 0x59, 0xe5, 0xb4, 0x5c, 0x71, 0x9a, 0x25, 0x02, 0x66, 0x09, 0x9e, 0x0e, 0x13,
+  0xdf, 0x83, 0x34, 0x99, 0x4c, 0x04, 0x2b, 0xce, 0x69, 0x43, 0xaa, 0x32, 0x6c, 0xb9, 0x33, 0x65,
+  0x13, 0xbd, 0xb4, 0x3f, 0x25, 0xbc, 0x69, 0x79, 0x6a, 0xf9, 0xd4, 0x17, 0x3b, 0x1c, 0x9b, 0x4c,
+  0xc9, 0x57, 0x15, 0x7d, 0xd8, 0x64, 0x79, 0xf2, 0x7a, 0x9a, 0x9a, 0xfe, 0xb6, 0x76, 0xae, 0x91,
+  0xac, 0xa2, 0x56, 0x21, 0x4c, 0xaf, 0xc0, 0xe3, 0x26, 0x9d, 0xea, 0xd9, 0x71, 0x9b, 0x07, 0x57,
+  0x76, 0xb8, 0xa0, 0xc6, 0xd5, 0x04, 0x4b, 0x58, 0x68, 0x63, 0xc3, 0x5f, 0xa4, 0xce, 0xdd, 0x2b,
+  0xcf, 0x70, 0x19, 0x57, 0xf0, 0x60, 0xc0, 0xd1, 0x1b, 0xe0, 0x09, 0x99, 0x7a, 0x07, 0xc6, 0x4e,
+  0xae, 0x2f, 0x29, 0x95, 0xc7, 0xfa, 0x65, 0xfe, 0x50, 0x0d, 0x05, 0xc9, 0x2e, 0x51, 0xd3, 0xc7,
+  0x9b, 0x5a, 0xd2, 0xd9, 0x69, 0xb5, 0x5a, 0xbb, 0xa6, 0xaf, 0x63, 0x7b, 0x39, 0xca, 0xd4, 0x0e,
+  0x83, 0x25, 0x36, 0x2a, 0xea, 0x78, 0x45, 0x04, 0xbc, 0x51, 0x1b, 0x7d, 0xe6, 0x03, 0x67, 0x07,
+  0xaf, 0x05, 0x09, 0xc5, 0x49, 0xbc, 0x3c, 0xbd, 0xfd, 0x15, 0xef, 0x2e, 0xd6, 0xc0, 0x6b, 0xe2,
+  0x22, 0xe2, 0x20, 0x24, 0x2e, 0xcd, 0xcc, 0x2d, 0x26, 0x51, 0x2c, 0xc7, 0xbb, 0x26, 0x51, 0xd4,
+  0x6a, 0xd6, 0xcc, 0x65, 0xb8, 0xc6, 0x34, 0xae, 0x95, 0x8a, 0xaf, 0x9c, 0xfa, 0x7b, 0x25, 0x73,
+  0x92, 0x57, 0x28, 0x0a, 0xc9, 0xb1, 0x02, 0x6d, 0x28, 0x46, 0x80, 0xe9, 0x5e, 0xec, 0x09, 0x73,
+  0xdb, 0x6c, 0x7f, 0x1f, 0x71, 0x07, 0x69, 0xca, 0x64, 0xe4, 0x89, 0x84, 0xa9, 0x33, 0xef, 0xa2,
+  0xf4, 0x62, 0xca, 0x0b, 0xa4, 0x05, 0xa5, 0x58, 0x4c, 0x5a, 0x91, 0x76, 0x9a, 0xa7, 0x3d, 0x8f,
+  0x86, 0xfa, 0x57, 0x5c, 0x22, 0x4e, 0xb7, 0x5e, 0xdc, 0x31, 0xbf, 0xce, 0xfe, 0x44, 0x4e, 0x27,
+  0xce, 0x10, 0xde, 0xd0, 0x40, 0x51, 0x60, 0xe6, 0xbe, 0xe1, 0x30, 0xb7, 0x39, 0xde, 0xdb, 0x80,
+  0xcb, 0xf4, 0x7b, 0x71, 0x5f, 0x84, 0x63, 0xcd, 0x6f, 0xe9, 0x98, 0xab, 0xea, 0x59, 0xcc, 0x26,
+  0xae, 0x7f, 0x1a, 0xf5, 0x81, 0xdc, 0x89, 0x56, 0x36, 0x8b, 0xaa, 0x76, 0x4e, 0x44, 0xb9, 0x1b,
+  0xfd, 0x45, 0xe1, 0x59, 0x4d, 0xeb, 0x45, 0x51, 0x59, 0x69, 0x76, 0x84, 0xa8, 0xf5, 0x88, 0xee,
+  0x3a, 0xd9, 0x82, 0x47, 0x4d, 0x6c, 0x9d, 0x81, 0x15, 0x88, 0x00, 0x28, 0xe3, 0x42, 0xb0, 0x8d,
+  0xc4, 0xd8, 0x88, 0x0b, 0x7e, 0x8f, 0x7f, 0x48, 0x01, 0x0a, 0xff, 0x86, 0x90, 0x28, 0x88, 0x2e,
+  0xe7, 0xf2, 0x3f, 0xf0, 0xbd, 0x98, 0x03, 0x5c, 0xc6, 0x8e, 0x65, 0x1a, 0x86, 0xf1, 0x28, 0x84,
+  0x3a, 0x8e, 0xb5, 0x8e, 0x8b, 0x15, 0x80, 0x60, 0xf6, 0xe8, 0xff, 0xe5, 0x07, 0xed, 0x4a, 0x4b,
+  0xca, 0x8c, 0xbf, 0xd3, 0x40, 0xd5, 0xc6, 0x8f, 0x0c, 0x44, 0xe0, 0x17, 0x47, 0x02, 0xcc, 0xc4,
+  0xbe, 0xb2, 0xca, 0x0b, 0xc8, 0x3a, 0x76, 0xa8, 0xb2, 0x83, 0xbb, 0x3f, 0x66, 0xa8, 0xfd, 0x66,
+  0x5e, 0xdb, 0x9b, 0x42, 0xa5, 0xa6, 0x3b, 0xb5, 0x3b, 0x25, 0xfa, 0xeb, 0x5b, 0xc4, 0x17, 0xd9,
+  0x07, 0x7d, 0x65, 0xa1, 0x16, 0x17, 0x01, 0x97, 0x4d, 0x92, 0x7e, 0x53, 0x7d, 0x12, 0x75, 0x97,
+  0xed, 0xd6, 0x16, 0x77, 0x0e, 0x1a, 0x93, 0x8e, 0xdd, 0xf2, 0x0a, 0x50, 0xe5, 0x90, 0x7a, 0x1a,
+  0x83, 0xb2, 0x8b, 0x8a, 0x17, 0x70, 0x98, 0x35, 0x75, 0x45, 0xf3, 0x2e, 0xc1, 0x2a, 0xb6, 0xf4,
+  0xd5, 0x6e, 0x60, 0x5c, 0x35, 0x57, 0xad, 0x2f, 0x37, 0xa5, 0x9b, 0xa2, 0x12, 0xa8, 0xea, 0x52,
+  0x33, 0x99, 0x59, 0x49, 0xf8, 0xbc, 0x25, 0x2f, 0x79, 0x59, 0x33, 0x1d, 0x8f, 0x7f, 0x88, 0xc2,
+  0xec, 0x6c, 0xf9, 0x2d, 0x7b, 0xe7, 0xa0, 0x2b, 0x34, 0x24, 0x6f, 0x0d, 0x00, 0xf2, 0x02, 0x34,
+  0xd1, 0x5e, 0xbc, 0xac, 0xd5, 0x5c, 0x9d, 0x8b, 0x91, 0x00, 0xe4, 0xeb, 0x3a, 0x20, 0x54, 0x3e,
+  0xb2, 0x80, 0x20, 0xdf, 0xd6, 0x01, 0xa0, 0xaf, 0x11, 0x11, 0x10, 0xd4, 0xeb, 0x3a, 0x20, 0xc4,
+  0x55, 0x41, 0x92, 0x88, 0xf8, 0x6c, 0x6c, 0x34, 0xa8, 0xf4, 0x0b, 0x7b, 0xfb, 0xd8, 0xb3, 0x77,
+  0x8f, 0xe5, 0x3e, 0x68, 0xc5, 0xa2, 0x31, 0x8f, 0x9c, 0x82, 0xe7, 0x27, 0x3d, 0xc0, 0x7e, 0x53,
+  0xca, 0x8e, 0x26, 0x16, 0x6c, 0x62, 0x80, 0x61, 0x09, 0x08, 0xe3, 0x14, 0x9f, 0x72, 0x1e, 0x4d,
+  0x10, 0x58, 0x00, 0x56, 0x01, 0xae, 0x8d, 0x2b, 0x23, 0x26, 0x51, 0xac, 0x86, 0xd2, 0xe5, 0x14,
+  0x5e, 0x25, 0x85, 0xa2, 0xaf, 0xcc, 0x77, 0xc3, 0x4f, 0x20, 0x6d, 0x25, 0x32, 0x47, 0x14, 0x1c,
+  0xfb, 0x72, 0x82, 0xd5, 0xc0, 0x10, 0x04, 0x52, 0x7c, 0xe6, 0xf8, 0x4c, 0x53, 0xa1, 0xa0, 0x89,
+  0x6c, 0x5d, 0x4f, 0x12, 0xab, 0x89, 0xa6, 0x81, 0x6c, 0xb2, 0x9c, 0x04, 0x42, 0x3f, 0x28, 0x19,
+  0x60, 0x52, 0x5e, 0xc6, 0xaa, 0x58, 0x83, 0xb5, 0x0b, 0x6a, 0x19, 0xa7, 0x5f, 0x95, 0xe4, 0x80,
+  0xff, 0x3b, 0xf8, 0xcd, 0x3c, 0x29, 0x68, 0x7e, 0x53, 0x6d, 0x65, 0xde, 0x7e, 0x55, 0x32, 0x48,
+  0xae, 0x6e, 0x86, 0x13, 0xab, 0x2e, 0x25, 0xef, 0x2f, 0xae, 0xad, 0x12, 0xe2, 0x91, 0x90, 0x66,
+  0xc2, 0x3d, 0x11, 0x14, 0x33, 0xed, 0x8b, 0xb9, 0x29, 0x12, 0x13, 0x6d, 0x3b, 0xc0, 0x48, 0x33,
+  0x03, 0xf9, 0x02, 0x16, 0x8a, 0xdb, 0x42, 0xba, 0x41, 0x75, 0x21, 0x84, 0xa0, 0x05, 0xda, 0x21,
+  0x1e, 0x79, 0x6e, 0x6e, 0xac, 0xec, 0xad, 0x8b, 0xd2, 0x0d, 0x05, 0xd2, 0xc8, 0x09, 0x29, 0x24,
+  0x26, 0x9a, 0x53, 0x6f, 0x64, 0xdf, 0x88, 0x5d, 0xbf, 0xc2, 0xc0, 0x79, 0x7c, 0x13, 0xcf, 0xf5,
+  0x35, 0x06, 0x17, 0x9e, 0x15, 0x72, 0xbc, 0x43, 0x11, 0x99, 0x6b, 0xaa, 0x46, 0x0b, 0x89, 0x65,
+  0xea, 0x55, 0xb6, 0xcd, 0x1f, 0xbb, 0xf6, 0xcd, 0x59, 0x65, 0x92, 0x06, 0x56, 0x68, 0x92, 0xed,
+  0xb3, 0x40, 0xc8, 0xf6, 0xf7, 0xa2, 0x3e, 0x06, 0x9a, 0x30, 0x9e, 0x61, 0x55, 0x42, 0xeb, 0xac,
+  0x21, 0x42, 0x22, 0x45, 0xcd, 0x39, 0xc5, 0x73, 0xf0, 0x88, 0x87, 0xb1, 0x2e, 0x8c, 0x8b, 0xb8,
+  0xaa, 0x1d, 0x53, 0xb9, 0x24, 0x01, 0xac, 0x5e, 0xcf, 0x6e, 0x55, 0x17, 0x3e, 0x56, 0x78, 0xd0,
+  0x8c, 0xa4, 0xb6, 0x05, 0xac, 0x63, 0xaa, 0xb8, 0x0e, 0x28, 0x6f, 0x90, 0x6c, 0x3a, 0xda, 0x73,
+  0x33, 0xee, 0x15, 0xf3, 0x69, 0xbb, 0xdc, 0xc1, 0x0b, 0xc3, 0x9c, 0x73, 0x3d, 0xb5, 0xf9, 0x82,
+  0xa9, 0xcd, 0x71, 0x6a, 0x73, 0x9a, 0xda, 0x14, 0xc3, 0x82, 0xeb, 0xce, 0xa9, 0xb1, 0xbd, 0xbf,
+  0x74, 0xd7, 0xae, 0x48, 0xa3, 0x15, 0x63, 0x87, 0x31, 0x88, 0x5d, 0x0c, 0xe8, 0x1d, 0xc7, 0x33,
+  0x37, 0x12, 0x61, 0x55, 0xa3, 0x85, 0x97, 0xe4, 0x21, 0x84, 0x49, 0x18, 0x8b, 0x6d, 0x0d, 0x3d,
+  0x14, 0x89, 0x7f, 0x8a, 0x81, 0x4b, 0x42, 0x5c, 0x5b, 0xff, 0xe2, 0xaf, 0x0c, 0xa9, 0x6b, 0xdf,
+  0x11, 0x7e, 0x11, 0x16, 0xc4, 0xc0, 0x20, 0x39, 0x7b, 0xe9, 0xd9, 0xf6, 0xb9, 0xe9, 0xfc, 0xa5,
+  0x67, 0x3b, 0xa5, 0xf7, 0xed, 0x73, 0xc1, 0x2c, 0xe9, 0xd9, 0xd3, 0xf3, 0x39, 0xdb, 0x62, 0xf8,
+  0xb4, 0xab, 0x9f, 0x9e, 0x9d, 0x0b, 0x06, 0x69, 0x38, 0xf3, 0xfa, 0x2e, 0x56, 0xf1, 0x1d, 0xf5,
+  0x16, 0x4a, 0xe9, 0xa2, 0x19, 0x5c, 0x16, 0x2e, 0x8e, 0x57, 0x6d, 0x72, 0xb5, 0xbf, 0x6b, 0xd5,
+  0x3a, 0x7e, 0x2a, 0xc5, 0x62, 0x9d, 0x85, 0xa7, 0x3b, 0x40, 0xde, 0xb3, 0xf2, 0x2c, 0x69, 0x3b,
+  0x1d, 0x18, 0x8d, 0x24, 0x39, 0x30, 0x15, 0x2d, 0x07, 0x7c, 0x40, 0xce, 0x76, 0xce, 0xcf, 0xb4,
+  0xb1, 0x0d, 0xd6, 0xbd, 0x31, 0xaf, 0x08, 0x67, 0x7e, 0xe1, 0x19, 0xa9, 0xce, 0xe7, 0xb6, 0xf5,
+  0x6c, 0x69, 0x5e, 0xbd, 0x8b, 0x27, 0xf6, 0xbd, 0x11, 0xc4, 0x1e, 0x13, 0x26, 0xfb, 0x04, 0xff,
+  0x84, 0x7b, 0xa5, 0x13, 0x9a, 0xfa, 0x6a, 0x1f, 0xe8, 0xe9, 0xb4, 0xc4, 0xd0, 0x28, 0x51, 0xd6,
+  0x4c, 0x17, 0x2b, 0xc7, 0x1f, 0x8c, 0x9c, 0xb1, 0x1e, 0x07, 0xdb, 0x80, 0x97, 0x25, 0x0e, 0xb5,
+  0x46, 0x7b, 0xe1, 0x7b, 0xba, 0xb6, 0xfa, 0x60, 0x7b, 0x97, 0xb2, 0x69, 0x44, 0x65, 0xda, 0x73,
+  0x15, 0x8f, 0x07, 0x58, 0x2c, 0x4b, 0x29, 0xda, 0x5b, 0x15, 0x50, 0x56, 0x4a, 0x0a, 0xda, 0x83,
+  0x45, 0x22, 0xbf, 0x5c, 0x42, 0x01, 0x05, 0x02, 0xd3, 0x20, 0xb3, 0x73, 0x2a, 0x4b, 0xcb, 0x5e,
+  0x6c, 0xa5, 0x5c, 0x61, 0x36, 0x08, 0x9f, 0x51, 0xb6, 0xb4, 0x9b, 0x51, 0xa6, 0x29, 0xfb, 0x03,
+  0xfd, 0x4d, 0x75, 0x4c, 0xd2, 0x7d, 0x9b, 0xf4, 0x01, 0xfa, 0x09, 0x25, 0x3f, 0x81, 0x98, 0xe1,
+  0x8d, 0xc3, 0x53, 0x99, 0x14, 0xf4, 0x4d, 0x29, 0x92, 0x2a, 0x9b, 0xda, 0x81, 0x54, 0xbd, 0xa4,
+  0xb5, 0x9b, 0x6e, 0xee, 0x58, 0xf5, 0x53, 0x0e, 0x9d, 0xca, 0x5d, 0x22, 0xd7, 0xc9, 0x53, 0x43,
+  0x04, 0xa8, 0x4c, 0x44, 0x15, 0xce, 0x12, 0x6b, 0x26, 0x6b, 0x66, 0xfc, 0xaf, 0x56, 0x44, 0xa5,
+  0x78, 0x79, 0x44, 0x9f, 0x71, 0x16, 0xf1, 0x01, 0x27, 0xf6, 0xc8, 0x0f, 0x51, 0xa9, 0x3c, 0x94,
+  0xa7, 0xdc, 0xd4, 0x5e, 0x34, 0x1e, 0x2d, 0xc3, 0x43, 0xc0, 0xb1, 0x7d, 0xf5, 0x9e, 0xdc, 0x69,
+  0x7e, 0xde, 0x91, 0xfb, 0xfc, 0x0f, 0xc5, 0xa2, 0x37, 0x3a, 0xc3, 0xad, 0x9b, 0xac, 0x49, 0x7b,
+  0x5f, 0x5e, 0xb5, 0x5c, 0xce, 0xbb, 0x58, 0xbe, 0xa2, 0xc8, 0x1f, 0xe4, 0x3c, 0xad, 0xa9, 0x8a,
+  0x66, 0x41, 0x26, 0x6b, 0x66, 0x64, 0x70, 0x64, 0xd6, 0x06, 0x50, 0x01, 0x61, 0xec, 0xc7, 0x53,
+  0x3f, 0xb2, 0x8a, 0x70, 0x43, 0x59, 0xc2, 0xbc, 0x50, 0xe4, 0xc2, 0xc9, 0x6f, 0xfa, 0x78, 0x0b,
+  0x6f, 0xf0, 0x72, 0x14, 0x46, 0x81, 0x0b, 0xf4, 0xd3, 0xd9, 0x61, 0xe2, 0xb7, 0xcd, 0xbe, 0x01,
+  0xd8, 0x05, 0x22, 0xa3, 0x99, 0x15, 0x2c, 0x44, 0x67, 0x3c, 0xaa, 0xa6, 0x98, 0xa8, 0x5b, 0xb5,
+  0xe3, 0x8a, 0xa5, 0x01, 0x2a, 0x5c, 0x43, 0x6e, 0x95, 0x57, 0x85, 0xc8, 0xc7, 0x34, 0xa4, 0x00,
+  0xd6, 0x96, 0x7f, 0x83, 0xf3, 0x40, 0x9a, 0x1b, 0xfa, 0x54, 0x42, 0xb1, 0x0f, 0xa9, 0x2d, 0x65,
+  0x91, 0xdd, 0x69, 0x06, 0x6a, 0x44, 0x96, 0x9f, 0x83, 0x47, 0x23, 0x68, 0x45, 0x11, 0x99, 0x69,
+  0xe1, 0x68, 0x44, 0xaa, 0x09, 0x8a, 0x26, 0x8e, 0x5a, 0x02, 0xa4, 0x4d, 0x99, 0x13, 0x88, 0x89,
+  0xec, 0xae, 0xf3, 0x2f, 0x0d, 0x3c, 0xb0, 0x71, 0xc2, 0xff, 0x2a, 0xc2, 0x1c, 0xba, 0x89, 0xe1,
+  0xeb, 0xab, 0x21, 0x64, 0xf9, 0x9d, 0x70, 0xde, 0xe2, 0xf5, 0x78, 0x22, 0x5e, 0xd2, 0x72, 0x0c,
+  0x10, 0x3a, 0xc1, 0xcf, 0x4c, 0xbb, 0x68, 0x3d, 0x55, 0x04, 0x4e, 0x49, 0xed, 0xbb, 0x72, 0x04,
+  0x39, 0xa5, 0xfd, 0x51, 0x7f, 0x5d, 0xb1, 0xd9, 0xd8, 0x6c, 0x36, 0x99, 0x18, 0x2b, 0x94, 0xe1,
+  0x42, 0xa3, 0x4b, 0xc0, 0x63, 0x71, 0x8f, 0x4e, 0x36, 0x49, 0xc5, 0xa1, 0x7d, 0xa8, 0xf5, 0xef,
+  0x22, 0xe4, 0x8e, 0x1b, 0x7b, 0x4c, 0x05, 0x1d, 0x0c, 0xa0, 0x46, 0x18, 0x2c, 0xaf, 0x26, 0x3f,
+  0x15, 0x93, 0x64, 0x5b, 0x21, 0x98, 0x0b, 0x65, 0x9e, 0x1c, 0x01, 0xe8, 0x8b, 0xaa, 0x6a, 0x3b,
+  0x7d, 0x41, 0x85, 0x6f, 0x0e, 0x58, 0x6e, 0x11, 0x15, 0x8c, 0x0f, 0x0a, 0x73, 0xd7, 0x56, 0x6f,
+  0x02, 0x3b, 0x86, 0x40, 0xdb, 0x7f, 0xd7, 0x52, 0x85, 0xd0, 0xc4, 0x36, 0xca, 0xca, 0xea, 0xe2,
+  0x9f, 0xe9, 0x5b, 0x82, 0x8f, 0xa8, 0x2c, 0x2c, 0xd7, 0x06, 0x56, 0x95, 0x4a, 0xad, 0x00, 0x69,
+  0x34, 0xcd, 0xfa, 0x69, 0x12, 0x45, 0xa7, 0xc9, 0xc4, 0xc6, 0x48, 0x14, 0xff, 0x40, 0x7f, 0x16,
+  0xb0, 0x58, 0x04, 0xc5, 0xc6, 0x77, 0x10, 0xbc, 0xbe, 0x82, 0x07, 0x4c, 0x84, 0xe6, 0x20, 0xbe,
+  0x5c, 0x95, 0xea, 0x00, 0x4e, 0x88, 0x22, 0xba, 0x95, 0xfc, 0x06, 0x38, 0x52, 0x46, 0xba, 0xe2,
+  0x7b, 0x4a, 0x5b, 0x0b, 0x65, 0x3a, 0xaf, 0x3e, 0xac, 0xe2, 0xc9, 0xd9, 0xe2, 0x20, 0x7d, 0x38,
+  0xc2, 0x7f, 0xc5, 0x07, 0xfe, 0x34, 0xca, 0x95, 0xb3, 0xa8, 0xd2, 0x1d, 0xd5, 0x51, 0x18, 0xba,
+  0x65, 0x0d, 0xcf, 0xc3, 0x0c, 0x39, 0x9d, 0x88, 0xc1, 0x89, 0xda, 0xa4, 0xbf, 0x50, 0xa2, 0x1c,
+  0x59, 0xb9, 0x84, 0xc4, 0x81, 0x1d, 0xcc, 0x47, 0x75, 0xea, 0x32, 0x66, 0x45, 0x02, 0x2c, 0xaa,
+  0x07, 0xf4, 0x7a, 0x41, 0x45, 0xf8, 0x32, 0x35, 0xd2, 0xca, 0x00, 0x56, 0xa9, 0xaa, 0x9e, 0x94,
+  0x46, 0x86, 0xc6, 0x52, 0x99, 0xa6, 0x46, 0x86, 0xa9, 0xca, 0x3b, 0x75, 0xe4, 0x91, 0x18, 0x9e,
+  0x0e, 0x92, 0x68, 0x98, 0xa2, 0x9d, 0xd2, 0x24, 0x86, 0x95, 0xe5, 0x03, 0x6b, 0x33, 0x01, 0x18,
+  0x4d, 0x66, 0x98, 0xea, 0x5e, 0x96, 0xe4, 0x7b, 0xfe, 0x99, 0x86, 0xc4, 0xfc, 0xde, 0x90, 0xf7,
+  0xd2, 0x04, 0x4f, 0x39, 0x9a, 0x19, 0x9f, 0xc5, 0x22, 0xa4, 0x19, 0x2c, 0x32, 0x1f, 0x80, 0xf4,
+  0x2a, 0xc4, 0x07, 0x56, 0x85, 0xb9, 0x28, 0xea, 0x09, 0x8f, 0x06, 0x48, 0xb9, 0xd5, 0x66, 0x29,
+  0x8b, 0xd4, 0xd2, 0xdf, 0x22, 0x4b, 0x82, 0x92, 0x33, 0x90, 0x08, 0xf0, 0xbb, 0xdc, 0x5c, 0x4c,
+  0xbc, 0xf9, 0xa7, 0x7d, 0x3c, 0x51, 0x87, 0xfe, 0xca, 0x8c, 0x08, 0xbf, 0x01, 0xc7, 0xc1, 0xbf,
+  0x25, 0x3c, 0xf7, 0xea, 0xfd, 0x3b, 0xc9, 0xf5, 0x6f, 0x81, 0x0c, 0x1c, 0xe7, 0xd6, 0xf5, 0x6c,
+  0xf6, 0x1b, 0xf9, 0x19, 0x06, 0x8c, 0x64, 0xd2, 0xbf, 0xce, 0x4d, 0xc6, 0xe2, 0x26, 0xb0, 0xac,
+  0x48, 0x77, 0x76, 0xdb, 0x32, 0xc9, 0xb3, 0xb2, 0x37, 0x85, 0xe3, 0x20, 0x10, 0x30, 0x84, 0xc7,
+  0xf4, 0x44, 0x49, 0xfe, 0xe6, 0x01, 0x05, 0x2a, 0xc4, 0xbf, 0x40, 0x4b, 0x59, 0x91, 0xf6, 0x37,
+  0x23, 0x11, 0x5e, 0xa6, 0xf5, 0xc2, 0xe0, 0x8e, 0xe5, 0x06, 0xbf, 0x3e, 0xda, 0x22, 0xd2, 0x97,
+  0xd5, 0x30, 0x45, 0xfe, 0x12, 0x76, 0x68, 0x44, 0x51, 0x0a, 0x30, 0xc8, 0x5a, 0xba, 0xbc, 0x9c,
+  0x2a, 0x6f, 0x7f, 0x2d, 0x67, 0xc9, 0x7b, 0x5e, 0x35, 0x4b, 0x7e, 0x13, 0x65, 0x89, 0x90, 0xd8,
+  0x26, 0x6a, 0x5a, 0xa3, 0x15, 0x67, 0x6b, 0xe0, 0x1f, 0x58, 0x0c, 0xe2, 0x3c, 0x16, 0x58, 0xd0,
+  0xe2, 0x18, 0xe5, 0x28, 0x1f, 0x47, 0xdd, 0x8d, 0xff, 0x05, 0x22, 0x23, 0x70, 0xa1, 0x03, 0x8a,
+  0x00, 0x00,
+};
@@ -0,0 +1,20 @@
+// Minimal Arduino surface for the native test environment: just the Stream interface that the
+// libraries under test use. The firmware build uses the real Arduino core instead.
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+class Stream {
+public:
+  virtual ~Stream() {}
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  virtual size_t write(uint8_t byte) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    for (size_t i = 0; i < size; i++) write(buffer[i]);
+    return size;
+  }
+  virtual void flush() {}
+};
@@ -0,0 +1,224 @@
+// Host tests for lib/CcTalk against a simulated device on the bus: pio test -e native
+#include <unity.h>
+#include <CcTalk.h>
+
+#include <deque>
+#include <vector>
+
+// --- Simulated Clock ---
+// The bus waits by calling idle(), which advances the clock, so a silent device times out
+// after CCTALK_REPLY_TIMEOUT_MS simulated milliseconds.
+static unsigned long simNow = 0;
+static unsigned long simClock() { return simNow; }
+static void simIdle() { simNow++; }
+
+// --- Simulated Device ---
+// Seen from the host it is the bus: every byte written is echoed back (single wire), and each
+// complete frame addressed to the device is answered like a coin acceptor would.
+enum class SimMode { ACK, NAK, SILENT, BAD_CHECKSUM, GARBLED_ECHO };
+
+class SimulatedDevice : public Stream {
+public:
+  uint8_t address = 2;
+  SimMode mode = SimMode::ACK;
+  uint8_t eventCounter = 0;
+  uint8_t results[2 * CCTALK_EVENT_SLOTS] = {}; // Result pairs, newest first
+  uint16_t inhibits = 0;
+  bool masterEnabled = false;
+  std::vector<uint8_t> lastFrame;
+
+  /** @brief Adds one event to the ring buffer the way the device does: counter 1..255, never 0. */
+  void addEvent(uint8_t type, uint8_t code) {
+    for (int i = 2 * CCTALK_EVENT_SLOTS - 1; i >= 2; i--) results[i] = results[i - 2];
+    results[0] = type;
+    results[1] = code;
+    eventCounter = eventCounter == 255 ? 1 : eventCounter + 1;
+  }
+
+  int available() override { return (int)rx.size(); }
+  int read() override {
+    if (rx.empty()) return -1;
+    uint8_t c = rx.front();
+    rx.pop_front();
+    return c;
+  }
+  int peek() override { return rx.empty() ? -1 : rx.front(); }
+
+  size_t write(uint8_t byte) override {
+    rx.push_back(mode == SimMode::GARBLED_ECHO && frame.empty() ? byte ^ 0xFF : byte);
+    frame.push_back(byte);
+    if (frame.size() >= 5 && frame.size() == 5u + frame[1]) {
+      lastFrame = frame;
+      frame.clear();
+      if (lastFrame[0] == address) answer();
+    }
+    return 1;
+  }
+  using Stream::write;
+
+private:
+  std::deque<uint8_t> rx;
+  std::vector<uint8_t> frame;
+
+  void answer() {
+    if (mode == SimMode::SILENT || mode == SimMode::GARBLED_ECHO) return;
+    std::vector<uint8_t> data;
+    uint8_t header = lastFrame[3];
+    if (header == CCTALK_HDR_MODIFY_INHIBITS && lastFrame[1] == 2) {
+      inhibits = lastFrame[4] | (lastFrame[5] << 8);
+    } else if (header == CCTALK_HDR_MODIFY_MASTER_INHIBIT && lastFrame[1] == 1) {
+      masterEnabled = lastFrame[4] & 1;
+    } else if (header == CCTALK_HDR_READ_COIN_EVENTS) {
+      data.push_back(eventCounter);
+      data.insert(data.end(), results, results + sizeof(results));
+    }
+    std::vector<uint8_t> reply = { CCTALK_HOST_ADDRESS, (uint8_t)data.size(), address,
+                                   (uint8_t)(mode == SimMode::NAK ? CCTALK_HDR_NAK : CCTALK_HDR_ACK) };
+    reply.insert(reply.end(), data.begin(), data.end());
+    reply.push_back(ccTalkChecksum(reply.data(), reply.size()) + (mode == SimMode::BAD_CHECKSUM ? 1 : 0));
+    rx.insert(rx.end(), reply.begin(), reply.end());
+  }
+};
+
+static SimulatedDevice* device;
+static CcTalkBus* bus;
+
+void setUp() {
+  simNow = 0;
+  device = new SimulatedDevice();
+  bus = new CcTalkBus(*device, simClock, simIdle);
+}
+
+void tearDown() {
+  delete bus;
+  delete device;
+}
+
+void test_checksum_makes_frame_sum_zero() {
+  const uint8_t poll[] = { 2, 0, 1, CCTALK_HDR_SIMPLE_POLL };
+  TEST_ASSERT_EQUAL_HEX8(0xFF, ccTalkChecksum(poll, sizeof(poll))); // 02 00 01 FE FF
+}
+
+void test_simple_poll_is_acknowledged() {
+  TEST_ASSERT_EQUAL(0, bus->transact(2, CCTALK_HDR_SIMPLE_POLL, nullptr, 0, nullptr, 0));
+  const uint8_t expected[] = { 2, 0, 1, CCTALK_HDR_SIMPLE_POLL, 0xFF };
+  TEST_ASSERT_EQUAL(sizeof(expected), device->lastFrame.size());
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, device->lastFrame.data(), sizeof(expected));
+}
+
+void test_poll_returns_new_events_oldest_first() {
+  device->addEvent(3, 1);
+  uint8_t last = device->eventCounter;
+  device->addEvent(4, 1);
+  device->addEvent(0, 2); // Status event: rejected
+  CcTalkEvents events;
+  TEST_ASSERT_EQUAL(11, bus->readEvents(2, false, last, events));
+  TEST_ASSERT_FALSE(events.reset);
+  TEST_ASSERT_EQUAL(0, events.lost);
+  TEST_ASSERT_EQUAL(2, events.count);
+  TEST_ASSERT_EQUAL(4, events.type[0]);
+  TEST_ASSERT_EQUAL(0, events.type[1]);
+  TEST_ASSERT_EQUAL(2, events.code[1]);
+  TEST_ASSERT_EQUAL(device->eventCounter, events.counter);
+}
+
+void test_event_counter_wraps_past_255_without_zero() {
+  TEST_ASSERT_EQUAL(3, ccTalkNewEvents(254, 2)); // 255, 1, 2
+  device->eventCounter = 254;
+  device->addEvent(5, 1); // 255
+  device->addEvent(6, 1); // 1
+  device->addEvent(7, 1); // 2
+  CcTalkEvents events;
+  TEST_ASSERT_GREATER_OR_EQUAL(0, bus->readEvents(2, false, 254, events));
+  TEST_ASSERT_EQUAL(2, events.counter);
+  TEST_ASSERT_EQUAL(3, events.count);
+  TEST_ASSERT_EQUAL(5, events.type[0]);
+  TEST_ASSERT_EQUAL(7, events.type[2]);
+}
+
+void test_events_beyond_the_buffer_are_counted_as_lost() {
+  for (int i = 1; i <= 7; i++) device->addEvent(i, 1);
+  CcTalkEvents events;
+  TEST_ASSERT_GREATER_OR_EQUAL(0, bus->readEvents(2, false, 0, events));
+  TEST_ASSERT_EQUAL(2, events.lost);
+  TEST_ASSERT_EQUAL(CCTALK_EVENT_SLOTS, events.count);
+  TEST_ASSERT_EQUAL(3, events.type[0]);
+  TEST_ASSERT_EQUAL(7, events.type[CCTALK_EVENT_SLOTS - 1]);
+}
+
+void test_counter_zero_reports_a_device_reset() {
+  CcTalkEvents events;
+  TEST_ASSERT_GREATER_OR_EQUAL(0, bus->readEvents(2, false, 17, events));
+  TEST_ASSERT_TRUE(events.reset);
+  TEST_ASSERT_EQUAL(0, events.count);
+}
+
+void test_inhibit_mask_is_sent_low_byte_first() {
+  TEST_ASSERT_EQUAL(0, bus->setInhibits(2, 0x0105));
+  TEST_ASSERT_EQUAL(CCTALK_HDR_MODIFY_INHIBITS, device->lastFrame[3]);
+  TEST_ASSERT_EQUAL_HEX8(0x05, device->lastFrame[4]);
+  TEST_ASSERT_EQUAL_HEX8(0x01, device->lastFrame[5]);
+  TEST_ASSERT_EQUAL_HEX16(0x0105, device->inhibits);
+}
+
+void test_master_enable_is_sent() {
+  TEST_ASSERT_EQUAL(0, bus->setMasterEnable(2, true));
+  TEST_ASSERT_TRUE(device->masterEnabled);
+  TEST_ASSERT_EQUAL(0, bus->setMasterEnable(2, false));
+  TEST_ASSERT_FALSE(device->masterEnabled);
+}
+
+void test_counter_zero_without_events_is_not_a_reset() {
+  // Also what a reset before the first event looks like, so the firmware reapplies the enables
+  CcTalkEvents events;
+  TEST_ASSERT_GREATER_OR_EQUAL(0, bus->readEvents(2, false, 0, events));
+  TEST_ASSERT_FALSE(events.reset);
+  TEST_ASSERT_EQUAL(0, events.count);
+}
+
+void test_nak_is_reported() {
+  device->mode = SimMode::NAK;
+  TEST_ASSERT_EQUAL(CCTALK_ERR_NAK, bus->setInhibits(2, 0xFFFF));
+}
+
+void test_silent_device_times_out() {
+  device->mode = SimMode::SILENT;
+  TEST_ASSERT_EQUAL(CCTALK_ERR_TIMEOUT, bus->transact(2, CCTALK_HDR_SIMPLE_POLL, nullptr, 0, nullptr, 0));
+  TEST_ASSERT_GREATER_OR_EQUAL(CCTALK_REPLY_TIMEOUT_MS, simNow);
+}
+
+void test_other_address_times_out() {
+  TEST_ASSERT_EQUAL(CCTALK_ERR_TIMEOUT, bus->transact(40, CCTALK_HDR_SIMPLE_POLL, nullptr, 0, nullptr, 0));
+}
+
+void test_bad_checksum_and_collision_are_frame_errors() {
+  device->mode = SimMode::BAD_CHECKSUM;
+  TEST_ASSERT_EQUAL(CCTALK_ERR_FRAME, bus->transact(2, CCTALK_HDR_SIMPLE_POLL, nullptr, 0, nullptr, 0));
+  device->mode = SimMode::GARBLED_ECHO;
+  TEST_ASSERT_EQUAL(CCTALK_ERR_FRAME, bus->transact(2, CCTALK_HDR_SIMPLE_POLL, nullptr, 0, nullptr, 0));
+}
+
+void test_short_event_reply_is_rejected() {
+  const uint8_t reply[] = { 1, 3, 1 };
+  CcTalkEvents events;
+  TEST_ASSERT_FALSE(ccTalkDecodeEvents(0, reply, sizeof(reply), events));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_checksum_makes_frame_sum_zero);
+  RUN_TEST(test_simple_poll_is_acknowledged);
+  RUN_TEST(test_poll_returns_new_events_oldest_first);
+  RUN_TEST(test_event_counter_wraps_past_255_without_zero);
+  RUN_TEST(test_events_beyond_the_buffer_are_counted_as_lost);
+  RUN_TEST(test_counter_zero_reports_a_device_reset);
+  RUN_TEST(test_inhibit_mask_is_sent_low_byte_first);
+  RUN_TEST(test_master_enable_is_sent);
+  RUN_TEST(test_counter_zero_without_events_is_not_a_reset);
+  RUN_TEST(test_nak_is_reported);
+  RUN_TEST(test_silent_device_times_out);
+  RUN_TEST(test_other_address_times_out);
+  RUN_TEST(test_bad_checksum_and_collision_are_frame_errors);
+  RUN_TEST(test_short_event_reply_is_rejected);
+  return UNITY_END();
+}
@@ -0,0 +1,82 @@
+"""
+Simulates a card terminal for the cashless payment integration.
+
+Speaks the line protocol of TcpCashlessProvider in src/main.cpp:
+
+    machine -> terminal:  PAY <ref> <cents>      CANCEL <ref>
+    terminal -> machine:  APPROVED <ref>  DECLINED <ref>  CANCELLED <ref>  ERROR <ref>
+
+Point the machine at this host in the admin app ("Zahlungsmittel" -> Kartenzahlung)
+and run: python tools/cashless_sim.py [--port 9100] [--delay 3] [--result approve]
+
+With --result ask, every payment waits for a key on stdin:
+a = approve, d = decline, e = error, n = no answer (test the timeout).
+"""
+import argparse
+import socket
+import threading
+
+
+def answer(conn, lock, text):
+    with lock:
+        print("-> " + text)
+        conn.sendall((text + "\n").encode())
+
+
+def handle(conn, args):
+    lock = threading.Lock()
+    open_payments = {}  # ref -> timer (or None while waiting for stdin)
+
+    def settle(ref, outcome):
+        if open_payments.pop(ref, "gone") == "gone":
+            return  # Cancelled meanwhile
+        if outcome:
+            answer(conn, lock, "%s %s" % (outcome, ref))
+
+    for raw in conn.makefile("r"):
+        parts = raw.split()
+        print("<- " + raw.strip())
+        if len(parts) == 3 and parts[0] == "PAY":
+            ref = parts[1]
+            if args.result == "ask":
+                open_payments[ref] = None
+                key = input("Payment %s over %.2f EUR [a/d/e/n]: " % (ref, int(parts[2]) / 100.0)).strip()
+                outcome = {"a": "APPROVED", "d": "DECLINED", "e": "ERROR"}.get(key)
+                settle(ref, outcome)
+            else:
+                outcome = {"approve": "APPROVED", "decline": "DECLINED"}[args.result]
+                timer = threading.Timer(args.delay, settle, (ref, outcome))
+                open_payments[ref] = timer
+                timer.start()
+        elif len(parts) == 2 and parts[0] == "CANCEL":
+            timer = open_payments.pop(parts[1], None)
+            if timer:
+                timer.cancel()
+            answer(conn, lock, "CANCELLED " + parts[1])
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--port", type=int, default=9100)
+    parser.add_argument("--delay", type=float, default=3.0, help="seconds until the automatic answer")
+    parser.add_argument("--result", choices=["approve", "decline", "ask"], default="approve")
+    args = parser.parse_args()
+
+    server = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    server.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    server.bind(("", args.port))
+    server.listen(1)
+    print("Terminal simulator listening on port %d" % args.port)
+    while True:
+        conn, address = server.accept()
+        print("Machine connected from %s" % address[0])
+        try:
+            handle(conn, args)
+        except (ConnectionError, OSError):
+            pass
+        conn.close()
+        print("Machine disconnected")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,54 @@
+"""
+Embeds the admin web app into the firmware.
+
+Gzips web/index.html and writes it as a byte array to src/web/admin_app.h,
+together with its length and an ETag derived from the compressed content.
+Runs automatically before every PlatformIO build (see extra_scripts in
+platformio.ini) and can also be run by hand: python tools/embed_web.py
+"""
+import gzip
+import os
+import zlib
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO
+    PROJECT_DIR = env["PROJECT_DIR"]  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SOURCE = os.path.join(PROJECT_DIR, "web", "index.html")
+TARGET = os.path.join(PROJECT_DIR, "src", "web", "admin_app.h")
+
+
+def build():
+    with open(SOURCE, "rb") as f:
+        html = f.read()
+    # mtime=0 keeps the output (and the ETag) identical for identical input
+    data = gzip.compress(html, compresslevel=9, mtime=0)
+    etag = "%08x" % (zlib.crc32(data) & 0xFFFFFFFF)
+
+    lines = [
+        "// Generated by tools/embed_web.py from web/index.html - do not edit.",
+        "#pragma once",
+        "",
+        "#define ADMIN_APP_ETAG \"\\\"%s\\\"\"" % etag,
+        "#define ADMIN_APP_GZ_LEN %d" % len(data),
+        "",
+        "static const uint8_t ADMIN_APP_GZ[] PROGMEM = {",
+    ]
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    lines.append("};")
+    content = "\n".join(lines) + "\n"
+
+    os.makedirs(os.path.dirname(TARGET), exist_ok=True)
+    if os.path.exists(TARGET):
+        with open(TARGET, "r") as f:
+            if f.read() == content:
+                return
+    with open(TARGET, "w") as f:
+        f.write(content)
+    print("embed_web: %s (%d -> %d bytes gzip)" % (os.path.relpath(TARGET, PROJECT_DIR), len(html), len(data)))
+
+
+build()